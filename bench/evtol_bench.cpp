@@ -0,0 +1,445 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+#include "Simulation.h"
+#include "ChargerManager.h"
+#include "FleetManifest.h"
+
+using namespace std;
+
+namespace {
+    /**
+     * @brief One measured result, written as one line of the JSON report.
+     */
+    struct BenchResult{
+        string name;                // Benchmark and its parameters, e.g. "run_Sim/vehicles=1000"
+        string unit;                // Unit of value
+        double value;               // Best time over the repetitions, in unit
+        double sim_HoursPerSecond;  // Simulated hours per wall-clock second, end-to-end runs only, 0 otherwise
+    };
+
+    const int repetitions = 5;                  // Timed repetitions per benchmark, the fastest is reported
+    const size_t micro_Vehicles = 4096;         // Fleet size of the per-vehicle microbenchmarks
+    const int micro_Passes = 64;                // Passes over the fleet per repetition
+    const size_t log_Calls = 1 << 20;           // Statistics calls per repetition
+    volatile double sink;                       // Keeps results alive so the timed loops are not optimized away
+
+    /**
+     * @brief Default vehicle types, the same five the simulation starts with.
+     */
+    vector<Vehicle> default_Types()
+    {
+        return {
+            Vehicle("Alpha Company", 120, 320, 0.6, 1.6, 4, 0.25),
+            Vehicle("Bravo Company", 100, 100, 0.2, 1.5, 5, 0.10),
+            Vehicle("Charlie Company", 160, 220, 0.8, 2.2, 3, 0.5),
+            Vehicle("Delta Company", 90, 120, 0.62, 0.8, 2, 0.22),
+            Vehicle("Echo Company", 30, 150, 0.3, 5.8, 2, 0.61),
+        };
+    }
+
+    /**
+     * @brief Builds a seeded fleet cycling through the default types.
+     *
+     * @param fleet Fleet to fill, cleared first.
+     * @param count Number of vehicles.
+     */
+    void build_Fleet(VehicleFleet &fleet, size_t count)
+    {
+        vector<Vehicle> types = default_Types();
+        fleet.clear();
+        fleet.set_Seed(1);
+        for (size_t i = 0; i < count; ++i)
+        {
+            fleet.add(static_cast<TypeId>(i % types.size()), types[i % types.size()]);
+        }
+    }
+
+    /**
+     * @brief Registers the default types in a Statistics.
+     */
+    void register_Types(Statistics &stats)
+    {
+        vector<Vehicle> types = default_Types();
+        for (size_t t = 0; t < types.size(); ++t)
+        {
+            stats.register_Type(static_cast<TypeId>(t), types[t].name);
+        }
+    }
+
+    /**
+     * @brief Runs a body several times and returns the fastest wall-clock time.
+     *
+     * @param prepare Untimed setup run before every repetition.
+     * @param body Timed work.
+     * @return double Seconds taken by the fastest repetition.
+     */
+    double best_Seconds(const function<void()> &prepare, const function<void()> &body)
+    {
+        double best = 0.0;
+        for (int r = 0; r < repetitions; ++r)
+        {
+            prepare();
+            auto start = chrono::steady_clock::now();
+            body();
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (r == 0 || seconds < best)
+                best = seconds;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Times the single-id and range forms of fly, charge and simulate_Fault.
+     *
+     * Each pass advances every vehicle of a 4096-vehicle fleet by a short step, small enough
+     * that no battery empties or fills within a repetition, so every call does the full work.
+     *
+     * @param results Receives one result per benchmark, in ns per vehicle-tick.
+     */
+    void bench_Fleet(vector<BenchResult> &results)
+    {
+        VehicleFleet fleet;
+        build_Fleet(fleet, micro_Vehicles);
+        const double dt = 1e-4;
+        const double ticks = double(micro_Vehicles) * micro_Passes;
+
+        auto full = [&]() { fleet.current_Battery = fleet.battery_Capacity; };
+        auto half = [&]() {
+            for (size_t i = 0; i < fleet.size(); ++i)
+                fleet.current_Battery[i] = fleet.battery_Capacity[i] / 2;
+        };
+
+        double s = best_Seconds(full, [&]() {
+            for (int p = 0; p < micro_Passes; ++p)
+                for (size_t i = 0; i < fleet.size(); ++i)
+                    fleet.fly(static_cast<int>(i), dt);
+        });
+        results.push_back({"fly/single", "ns/vehicle-tick", s * 1e9 / ticks, 0.0});
+
+        s = best_Seconds(full, [&]() {
+            for (int p = 0; p < micro_Passes; ++p)
+                fleet.fly(0, fleet.size(), dt);
+        });
+        results.push_back({"fly/range", "ns/vehicle-tick", s * 1e9 / ticks, 0.0});
+
+        s = best_Seconds(half, [&]() {
+            for (int p = 0; p < micro_Passes; ++p)
+                for (size_t i = 0; i < fleet.size(); ++i)
+                    fleet.charge(static_cast<int>(i), dt);
+        });
+        results.push_back({"charge/single", "ns/vehicle-tick", s * 1e9 / ticks, 0.0});
+
+        s = best_Seconds(half, [&]() {
+            for (int p = 0; p < micro_Passes; ++p)
+                fleet.charge(0, fleet.size(), dt);
+        });
+        results.push_back({"charge/range", "ns/vehicle-tick", s * 1e9 / ticks, 0.0});
+
+        int faults = 0;
+        s = best_Seconds(full, [&]() {
+            for (int p = 0; p < micro_Passes; ++p)
+                for (size_t i = 0; i < fleet.size(); ++i)
+                    faults += fleet.simulate_Fault(static_cast<int>(i));
+        });
+        results.push_back({"simulate_Fault", "ns/vehicle-tick", s * 1e9 / ticks, 0.0});
+
+        sink = fleet.current_Battery[0] + faults;
+    }
+
+    /**
+     * @brief Times ChargerManager::charge_Update with a given number of vehicles queued.
+     *
+     * Every vehicle starts empty and asks for a charger; the step is short enough that no
+     * charge completes, so the queue depth stays fixed while the update is timed.
+     *
+     * @param results Receives one result per depth, in ns per update.
+     * @param depths Queue depths to measure.
+     */
+    void bench_ChargeUpdate(vector<BenchResult> &results, const vector<size_t> &depths)
+    {
+        const int chargers = 3;
+        const int updates = 1 << 14;
+
+        for (size_t depth : depths)
+        {
+            Statistics stats;
+            register_Types(stats);
+            VehicleFleet fleet;
+            build_Fleet(fleet, depth + chargers);
+            ChargerManager manager(stats, fleet, chargers);
+
+            vector<int> ids(fleet.size());
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                ids[i] = static_cast<int>(i);
+                fleet.current_Battery[i] = 0.0;
+            }
+            manager.charge_Request(ids.data(), ids.size());
+
+            double s = best_Seconds([&]() {
+                for (int id : ids)
+                    if (manager.is_Charging(id))
+                        fleet.current_Battery[id] = 0.0;
+            }, [&]() {
+                for (int u = 0; u < updates; ++u)
+                    manager.charge_Update(1e-6);
+            });
+            results.push_back({"charge_Update/queue=" + to_string(depth), "ns/update", s * 1e9 / updates, 0.0});
+            sink = double(manager.queue_Length());
+        }
+    }
+
+    /**
+     * @brief Times each Statistics logging call.
+     *
+     * @param results Receives one result per call, in ns per call.
+     */
+    void bench_Statistics(vector<BenchResult> &results)
+    {
+        Statistics stats;
+        register_Types(stats);
+        const TypeId types = static_cast<TypeId>(stats.StatList.size());
+        auto reset = [&]() { stats.clear(); };
+
+        double s = best_Seconds(reset, [&]() {
+            for (size_t i = 0; i < log_Calls; ++i)
+                stats.log_Flight(static_cast<TypeId>(i % types), 0.5 + (i & 255) * 1e-3, 60.0, 4);
+        });
+        results.push_back({"log_Flight", "ns/call", s * 1e9 / log_Calls, 0.0});
+
+        s = best_Seconds(reset, [&]() {
+            for (size_t i = 0; i < log_Calls; ++i)
+                stats.log_Charge(static_cast<TypeId>(i % types), 0.2 + (i & 255) * 1e-3);
+        });
+        results.push_back({"log_Charge", "ns/call", s * 1e9 / log_Calls, 0.0});
+
+        s = best_Seconds(reset, [&]() {
+            for (size_t i = 0; i < log_Calls; ++i)
+                stats.log_Faults(static_cast<TypeId>(i % types));
+        });
+        results.push_back({"log_Faults", "ns/call", s * 1e9 / log_Calls, 0.0});
+
+        s = best_Seconds(reset, [&]() {
+            for (size_t i = 0; i < log_Calls; ++i)
+                stats.log_Wait(static_cast<TypeId>(i % types), (i & 1023) * 1e-3);
+        });
+        results.push_back({"log_Wait", "ns/call", s * 1e9 / log_Calls, 0.0});
+
+        sink = stats.StatList[0].total_FlightTime;
+    }
+
+    /**
+     * @brief Times complete fixed-step runs at several fleet sizes.
+     *
+     * The fleet is split evenly over the default types and shares the default 3 chargers,
+     * as in a plain `sim` run. Building the fleet is not timed. Small fleets are run many
+     * times per repetition so the timer resolution does not dominate.
+     *
+     * @param results Receives one result per size, in ns per vehicle-tick, with sim-hours per second.
+     * @param sizes Fleet sizes to measure.
+     * @param tick_Threads Threads passed to Simulation::set_TickThreads.
+     */
+    void bench_RunSim(vector<BenchResult> &results, const vector<size_t> &sizes, size_t tick_Threads)
+    {
+        vector<Vehicle> types = default_Types();
+
+        for (size_t vehicles : sizes)
+        {
+            ostringstream text;
+            for (const Vehicle &t : types)
+                text << "type," << t.name << "," << t.cruiseSpeed << "," << t.battery_Capacity << "," << t.timeTo_Charge << ","
+                     << t.energy_PerMile << "," << t.passenger_Count << "," << t.fault_Probability << "\n";
+            for (size_t t = 0; t < types.size(); ++t)
+                text << "fleet," << types[t].name << "," << (vehicles / types.size() + (t < vehicles % types.size())) << "\n";
+
+            FleetManifest manifest;
+            manifest.parse(text.str());
+
+            const size_t runs = max<size_t>(1, min<size_t>(1000, 200000 / vehicles));
+            vector<unique_ptr<Simulation>> sims(runs);
+
+            double s = best_Seconds([&]() {
+                for (unique_ptr<Simulation> &sim : sims)
+                {
+                    sim.reset();                // Frees the previous fleet before the next is built
+                    sim.reset(new Simulation());
+                    sim->set_Seed(1);
+                    sim->set_PrintSummary(false);
+                    sim->set_FaultLogPath("");
+                    sim->set_TickThreads(tick_Threads);
+                    sim->vehicle_Init(manifest);
+                }
+            }, [&]() {
+                for (unique_ptr<Simulation> &sim : sims)
+                    sim->run_Sim();
+            });
+
+            double ticks = sims[0]->get_SimTime() / sims[0]->get_TimeIncrement();
+            double vehicle_Ticks = double(runs) * vehicles * ticks;
+            double sim_Hours = double(runs) * sims[0]->get_SimTime();
+            results.push_back({"run_Sim/vehicles=" + to_string(vehicles), "ns/vehicle-tick", s * 1e9 / vehicle_Ticks, sim_Hours / s});
+            sims.clear();
+        }
+    }
+
+    /**
+     * @brief Writes the results as JSON, one benchmark per line so reports diff line by line.
+     */
+    void write_Json(ostream &out, const vector<BenchResult> &results)
+    {
+        out << "{\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchResult &r = results[i];
+            out << "    {\"name\": \"" << r.name << "\", \"unit\": \"" << r.unit << "\", \"value\": "
+                << fixed << setprecision(3) << r.value;
+            if (r.sim_HoursPerSecond > 0)
+                out << ", \"sim_hours_per_second\": " << setprecision(1) << r.sim_HoursPerSecond;
+            out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    /**
+     * @brief Reads the name and value of every benchmark in a report written by write_Json.
+     *
+     * @param path Baseline report.
+     * @param values Receives the value of each benchmark by name.
+     * @return true if the file could be read; false otherwise.
+     */
+    bool read_Baseline(const string &path, map<string, double> &values)
+    {
+        ifstream in(path);
+        if (!in)
+            return false;
+
+        string line;
+        while (getline(in, line))
+        {
+            size_t name = line.find("\"name\": \"");
+            size_t value = line.find("\"value\": ");
+            if (name == string::npos || value == string::npos)
+                continue;
+            name += 9;
+            values[line.substr(name, line.find('"', name) - name)] = strtod(line.c_str() + value + 9, nullptr);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Prints each result next to its baseline and flags slowdowns beyond a threshold.
+     *
+     * @return int Number of benchmarks that regressed.
+     */
+    int compare(ostream &out, const vector<BenchResult> &results, const map<string, double> &baseline, double threshold)
+    {
+        int regressions = 0;
+        out << left << setw(32) << "Benchmark" << right << setw(14) << "Baseline" << setw(14) << "Current" << setw(10) << "Ratio" << "\n";
+        for (const BenchResult &r : results)
+        {
+            auto it = baseline.find(r.name);
+            out << left << setw(32) << r.name << right << fixed << setprecision(3);
+            if (it == baseline.end() || it->second <= 0)
+            {
+                out << setw(14) << "-" << setw(14) << r.value << "\n";
+                continue;
+            }
+
+            double ratio = r.value / it->second;
+            out << setw(14) << it->second << setw(14) << r.value << setw(10) << setprecision(2) << ratio;
+            if (ratio > 1.0 + threshold)
+            {
+                out << "  slower";
+                regressions++;
+            }
+            out << "\n";
+        }
+        return regressions;
+    }
+
+    /**
+     * @brief Prints how to call the tool.
+     */
+    void print_Usage()
+    {
+        cout << "Usage: evtol-bench [options]\n"
+             << "  --max-vehicles N    largest run_Sim fleet, sizes go 20, 1000, 10^4 ... up to N (default 1000000)\n"
+             << "  --tick-threads T    threads used by the run_Sim benchmarks (default 1)\n"
+             << "  --out FILE          write the JSON report to FILE instead of stdout\n"
+             << "  --compare FILE      compare against a stored report, exit 1 if any benchmark is slower\n"
+             << "  --threshold F       fraction a benchmark may slow down before it counts as slower (default 0.10)\n";
+    }
+}
+
+/**
+ * @brief Times the simulation hot paths and reports them as JSON.
+ *
+ * @return int 0 on success, 1 if a comparison found a regression, 2 on bad arguments.
+ */
+int main(int argc, char *argv[])
+{
+    size_t max_Vehicles = 1000000;
+    size_t tick_Threads = 1;
+    const char *out_Path = nullptr;
+    const char *baseline_Path = nullptr;
+    double threshold = 0.10;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--max-vehicles") == 0 && i + 1 < argc)
+            max_Vehicles = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--tick-threads") == 0 && i + 1 < argc)
+            tick_Threads = max(atoi(argv[++i]), 1);
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            out_Path = argv[++i];
+        else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+            baseline_Path = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            threshold = atof(argv[++i]);
+        else
+        {
+            print_Usage();
+            return 2;
+        }
+    }
+
+    map<string, double> baseline;
+    if (baseline_Path && !read_Baseline(baseline_Path, baseline))
+    {
+        cerr << "Cannot read baseline " << baseline_Path << endl;
+        return 2;
+    }
+
+    vector<size_t> sizes = {20};
+    for (size_t n = 1000; n <= max_Vehicles; n *= 10)
+        sizes.push_back(n);
+
+    vector<BenchResult> results;
+    bench_Fleet(results);
+    bench_ChargeUpdate(results, {0, 10, 1000, 100000});
+    bench_Statistics(results);
+    bench_RunSim(results, sizes, tick_Threads);
+
+    if (out_Path)
+    {
+        ofstream out(out_Path);
+        write_Json(out, results);
+    }
+    else if (!baseline_Path)
+        write_Json(cout, results);
+
+    if (baseline_Path)
+        return compare(cout, results, baseline, threshold) > 0 ? 1 : 0;
+    return 0;
+}
\ No newline at end of file
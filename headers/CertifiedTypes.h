@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Compile-time definition of a vehicle type.
+ *
+ * Mirrors the constructor arguments of Vehicle, so a table of them can be checked and
+ * folded by the compiler.
+ */
+struct TypeSpec{
+    const char *name;               // Name of the vehicle company
+    double cruiseSpeed;             // Cruise speed in miles per hour
+    double battery_Capacity;        // Battery capacity in kWh
+    double timeTo_Charge;           // Hours to charge a full battery
+    double energy_PerMile;          // Energy consumption per mile in kWh
+    int passenger_Count;            // Passengers carried per trip
+    double fault_Probability;       // Probability of a fault per flight hour
+
+    /**
+     * @brief Computes the charge rate exactly as VehicleFleet does for a runtime type.
+     * @return kWh added per hour of charging.
+     */
+    constexpr double charge_Rate() const{
+        return battery_Capacity / timeTo_Charge;
+    }
+
+    /**
+     * @brief Checks the parameters the kernels divide by or count with.
+     * @return true if speed, capacity, charge time and energy use are positive and the rest non-negative.
+     */
+    constexpr bool valid() const{
+        return cruiseSpeed > 0 && battery_Capacity > 0 && timeTo_Charge > 0 && energy_PerMile > 0 &&
+               passenger_Count >= 0 && fault_Probability >= 0;
+    }
+};
+
+/**
+ * @brief The five certified vehicle types from the original specification.
+ *
+ * vehicle_Init registers these, and FleetKernels has a flight and a charging kernel
+ * instantiated for each, with its energy use, passenger count, capacity and charge rate
+ * compiled in. Builds with -DEVTOL_CERTIFIED_TYPES route every vehicle whose type matches
+ * an entry to those kernels.
+ */
+inline constexpr TypeSpec certified_Types[] = {
+    {"Alpha Company",   120, 320, 0.6,  1.6, 4, 0.25},
+    {"Bravo Company",   100, 100, 0.2,  1.5, 5, 0.10},
+    {"Charlie Company", 160, 220, 0.8,  2.2, 3, 0.5},
+    {"Delta Company",    90, 120, 0.62, 0.8, 2, 0.22},
+    {"Echo Company",     30, 150, 0.3,  5.8, 2, 0.61},
+};
+
+inline constexpr size_t certified_TypeCount = sizeof(certified_Types) / sizeof(certified_Types[0]);    // Entries in certified_Types
+
+/**
+ * @brief Checks every entry of the certified table at compile time.
+ */
+constexpr bool certified_TypesValid()
+{
+    for (const TypeSpec &t : certified_Types)
+    {
+        if (!t.valid())
+            return false;
+    }
+    return true;
+}
+
+static_assert(certified_TypeCount > 0, "At least one certified type is needed");
+static_assert(certified_TypesValid(), "Every certified type needs positive speed, capacity, charge time and energy use");
\ No newline at end of file
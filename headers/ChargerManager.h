@@ -1,34 +1,90 @@
 #pragma once
 
-#include <queue>
 #include <vector>
-#include <unordered_set>
+#include <memory_resource>
+#include <cstddef>
 
-#include "Vehicle_Instance.h"
+#include "VehicleFleet.h"
 #include "Statistics.h"
+#include "ChargerPolicies.h"
+#include "IndexedHeap.h"
 
 /**
  * @brief Manages the scheduling and allocation of charging resources for electric vehicles.
  * 
  * Handles both active charging and the waiting queue. Vehicles requests
  * a charger through this manager, which decides whether to allow charging immediately
- * or queue the vehicle until a charger is available.
+ * or queue the vehicle until a charger is available. Vehicles are identified by their
+ * id in the fleet.
+ * 
+ * Each vehicle's charger state lives on the fleet (VehicleFleet::charge_State), so lookups
+ * are a single array read. Vehicles on a charger are packed into a slot array sized to the
+ * number of chargers and leave it by swap-remove; queued vehicles wait in a queue sized to
+ * the fleet.
+ * 
+ * Charging is lazy. Vehicles on a charger sit in a min-heap keyed by the clock time the
+ * manager next has to touch them. A vehicle enters keyed by the time it plugged in, so the
+ * first update charges it once and an emptied battery shows its first charge as it would
+ * with eager charging; it is then re-keyed by the exact time it will be full, computed
+ * from its remaining capacity and charge rate. An update advances the clock and pops only
+ * the vehicles whose key has passed, so it costs O(k log n) for the k vehicles plugging in
+ * or finishing rather than O(n) over every charger. A charging vehicle's battery is
+ * brought up to the clock when it leaves its charger, on reset() and on sync().
+ * 
+ * Steady-state requests and updates never allocate. The slots and the queue allocate from
+ * the fleet's memory resource, so they live in the simulation's arena.
+ * 
+ * The order in which queued vehicles get a charger is set by the Queue policy (see
+ * ChargerPolicies.h): FifoQueue, ShortestChargeQueue, LowestBatteryQueue or WeightedFairQueue.
+ * The heap-based policies keep every queue operation O(log n) at any queue depth.
+ * 
+ * Every vehicle's wait from request to charger is logged to the Statistics. The manager's
+ * clock advances with charge_Update; an engine that never calls it sets the clock instead.
+ * 
+ * @tparam Queue Admission policy holding the waiting vehicles.
  */
-class ChargerManager{
+template <class Queue>
+class BasicChargerManager{
     private:
         int maxChargers;                                        // Maximum number of chargers available
-        std::queue<VehicleInstance*> waiting_Queue;             // Queue to store vehicles waiting for a charger
-        std::vector<VehicleInstance*> charging_Vehicles;        // List of vehicles currently being charged
-        std::unordered_set<VehicleInstance*> known_Vehicles;    // Tracks vehicles being charged or queued
+        std::pmr::vector<int> charging_Vehicles;                // Vehicles on a charger, reserved to maxChargers slots
+        IndexedHeap<> finishing;                                // Vehicles on a charger keyed by the clock time they next need an update
+        Queue waiting;                                          // Vehicles waiting for a charger, in admission order
+        double clock = 0.0;                                     // Current time as seen by the manager, for queue waits
 
-        Statistics& stats;                                      // Reference to the global Statistics object
+        Statistics* stats;                                      // Statistics object charges and waits are logged into
+        VehicleFleet& fleet;                                    // Reference to the fleet holding vehicle state
+
+        void plug_In(int id);                                   // Puts a vehicle on a free charger slot
+        void unplug(int id);                                    // Swap-removes a vehicle from its charger slot
 
     public:
          
-        ChargerManager(Statistics& statsRef, int chargers_Available = 3);   // Constructor function for class ChargerManager
+        BasicChargerManager(Statistics& statsRef, VehicleFleet& fleetRef, int chargers_Available = 3);   // Constructor function for class ChargerManager
 
-        void charge_Request(VehicleInstance* v);                            //  Requests charger when battery is depleted
+        void charge_Request(int id);                                        //  Requests charger when battery is depleted
+        void charge_Request(const int *ids, size_t count);                  // Requests chargers for several vehicles in order
         void charge_Update(double time_increment);                          // Progresses the charging and updates charging and waiting queue
         bool charger_Availability() const;                                  // Checks if a charger is free
+        bool is_Charging(int id) const;                                     // Checks if a vehicle currently occupies a charger
+        bool is_Waiting(int id) const;                                      // Checks if a vehicle is queued for a charger
+        size_t queue_Length() const;                                        // Number of vehicles waiting for a charger
+        size_t charging_Count() const;                                      // Number of vehicles on a charger
+        int queued_At(size_t index) const;                                  // Vehicle at an index of the queue, below queue_Length()
+        bool holds(int id) const;                                           // Checks that a vehicle sits in the charger slot it records
+        int charge_Release(int id);                                         // Frees the charger held by a vehicle and promotes the next queued one
+        void sync(int id);                                                  // Brings a charging vehicle's battery up to the current time
+        void sync();                                                        // Brings every charging vehicle's battery up to the current time
+        void set_Statistics(Statistics& statsRef);                          // Redirects logging, e.g. to a per-thread shard
+        void set_Clock(double time);                                        // Sets the current time used to measure queue waits
+        void reprioritize(int id);                                          // Moves a queued vehicle after its state changed
         void reset();                                                       // Resets internal queues and charger state.
-};
\ No newline at end of file
+        void save(CheckpointWriter &out) const;                             // Writes the charger slots, queue and clock to a checkpoint
+        bool load(CheckpointReader &in);                                    // Replaces the slots, queue and clock with those read from a checkpoint
+        Queue& get_Queue();                                                 // Getter function to configure the admission policy
+};
+
+using ChargerManager = BasicChargerManager<FifoQueue>;                     // First-come first-served, the default
+using ShortestChargeManager = BasicChargerManager<ShortestChargeQueue>;    // Shortest remaining charge first
+using LowestBatteryManager = BasicChargerManager<LowestBatteryQueue>;      // Lowest state of charge first
+using WeightedFairManager = BasicChargerManager<WeightedFairQueue>;        // Charger time shared between types by weight
\ No newline at end of file
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+
+#include "Vehicle.h"
+#include "VehicleFleet.h"
+#include "IndexedHeap.h"
+#include "Checkpoint.h"
+
+/**
+ * @brief First-come first-served charger queue, a ring buffer of vehicle ids.
+ *
+ * The default admission policy of ChargerManager. Like every queue policy it is told the
+ * fleet size up front through reserve(), so pushes never allocate.
+ */
+class FifoQueue{
+    private:
+        std::pmr::vector<int> ring;         // Ring buffer of queued vehicle ids, power-of-two capacity
+        size_t head = 0;                    // Ring index of the vehicle waiting longest
+        size_t count = 0;                   // Number of queued vehicles
+
+    public:
+        explicit FifoQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource());   // Creates an empty queue allocating from resource
+
+        void reserve(size_t vehicles);                          // Makes room for every vehicle of a fleet this size
+        void push(const VehicleFleet &fleet, int id);           // Appends a vehicle at the back
+        int pop();                                              // Removes the vehicle waiting longest
+        void update(const VehicleFleet &fleet, int id);         // Nothing to do, arrival order never changes
+        size_t size() const;                                    // Number of queued vehicles
+        int at(size_t index) const;                             // Vehicle at a place in the queue, 0 waiting longest
+        void save(CheckpointWriter &out) const;                 // Writes the queued vehicles in order to a checkpoint
+        bool load(CheckpointReader &in, const VehicleFleet &fleet);   // Replaces the queue with one read from a checkpoint
+};
+
+/**
+ * @brief Shortest charge first: the vehicle needing the least time on a charger goes next.
+ *
+ * For a depleted vehicle this is its type's timeTo_Charge.
+ */
+struct ShortestChargePriority{
+    double key(const VehicleFleet &fleet, int id);              // Hours of charging the vehicle still needs
+    void served(double /*key*/) {}                              // Keys do not depend on what was served before
+    void save(CheckpointWriter &/*out*/) const {}               // No state to write
+    bool load(CheckpointReader &/*in*/) { return true; }        // No state to read
+};
+
+/**
+ * @brief Lowest battery first: the vehicle with the smallest state of charge goes next.
+ */
+struct LowestBatteryPriority{
+    double key(const VehicleFleet &fleet, int id);              // Fraction of battery capacity left
+    void served(double /*key*/) {}                              // Keys do not depend on what was served before
+    void save(CheckpointWriter &/*out*/) const {}               // No state to write
+    bool load(CheckpointReader &/*in*/) { return true; }        // No state to read
+};
+
+/**
+ * @brief Weighted fair queueing between vehicle types.
+ *
+ * Each vehicle is stamped with a virtual finish time: the later of the current virtual
+ * time and its type's previous finish time, plus its charge time divided by its type's
+ * weight. Smallest finish time goes next, so over a busy period each type receives
+ * charger time in proportion to its weight and no type starves. Types without a weight
+ * have weight 1.
+ */
+class WeightedFairPriority{
+    private:
+        std::vector<double> weights;            // Share of each type, indexed by TypeId
+        std::vector<double> last_Finish;        // Virtual finish time of the last vehicle queued per type
+        double virtual_Time = 0.0;              // Finish time of the vehicle served last
+
+    public:
+        void set_Weight(TypeId type, double weight);            // Sets a type's share of charger time
+        double key(const VehicleFleet &fleet, int id);          // Stamps a vehicle with its virtual finish time
+        void served(double key);                                // Advances the virtual time to the served vehicle
+        void save(CheckpointWriter &out) const;                 // Writes the weights and virtual times to a checkpoint
+        bool load(CheckpointReader &in);                        // Replaces the weights and virtual times with those read from a checkpoint
+};
+
+/**
+ * @brief Charger queue ordered by a priority, kept in an indexed d-ary heap.
+ *
+ * Push, pop and priority updates are O(log n) in the number of waiting vehicles, and
+ * vehicles with equal priority leave in arrival order.
+ *
+ * @tparam Priority Computes a vehicle's key (smallest goes first) and is told each served key.
+ * @tparam Arity Children per heap node.
+ */
+template <class Priority, int Arity = 4>
+class HeapQueue{
+    private:
+        IndexedHeap<Arity> heap;            // Queued vehicles keyed by priority
+        Priority priority;                  // Policy computing the keys
+
+    public:
+        /**
+         * @brief Creates an empty queue whose heap allocates from a memory resource.
+         *
+         * @param resource Memory the heap and its position index allocate from.
+         */
+        explicit HeapQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : heap(resource) {}
+
+        /**
+         * @brief Sizes the heap and its position index for a fleet.
+         *
+         * @param vehicles Number of vehicles in the fleet.
+         */
+        void reserve(size_t vehicles)
+        {
+            heap.reserve(vehicles);
+        }
+
+        /**
+         * @brief Queues a vehicle under its current priority.
+         *
+         * @param fleet Fleet holding the vehicle's state.
+         * @param id Fleet id of the vehicle.
+         */
+        void push(const VehicleFleet &fleet, int id)
+        {
+            heap.push(id, priority.key(fleet, id));
+        }
+
+        /**
+         * @brief Removes the vehicle with the best priority.
+         *
+         * @return int Fleet id of the vehicle; the queue must not be empty.
+         */
+        int pop()
+        {
+            priority.served(heap.top_Key());
+            return heap.pop();
+        }
+
+        /**
+         * @brief Recomputes a queued vehicle's priority after its state changed.
+         *
+         * @param fleet Fleet holding the vehicle's state.
+         * @param id Fleet id of the vehicle; ignored if not queued.
+         */
+        void update(const VehicleFleet &fleet, int id)
+        {
+            if (heap.contains(id))
+                heap.update(id, priority.key(fleet, id));
+        }
+
+        /**
+         * @brief Returns the number of queued vehicles.
+         */
+        size_t size() const
+        {
+            return heap.size();
+        }
+
+        /**
+         * @brief Returns a queued vehicle by its index in the heap, in no particular order.
+         *
+         * @param index Heap index, below size().
+         */
+        int at(size_t index) const
+        {
+            return heap.at(index);
+        }
+
+        /**
+         * @brief Writes the heap and the policy state to a checkpoint.
+         *
+         * @param out Checkpoint being written.
+         */
+        void save(CheckpointWriter &out) const
+        {
+            heap.save(out);
+            priority.save(out);
+        }
+
+        /**
+         * @brief Replaces the heap and the policy state with those written by save().
+         *
+         * @param in Checkpoint positioned at the queue.
+         * @param fleet Fleet the queued ids refer to.
+         * @return true if the queue was read and holds distinct fleet vehicles marked as queued; false otherwise.
+         */
+        bool load(CheckpointReader &in, const VehicleFleet &fleet)
+        {
+            heap.reserve(fleet.size());
+            if (!heap.load(in, fleet.size()))
+                return false;
+
+            for (size_t i = 0; i < heap.size(); ++i)
+            {
+                if (fleet.charge_State[heap.at(i)] != ChargeState::Queued)
+                {
+                    heap.clear();
+                    return false;
+                }
+            }
+            return priority.load(in);
+        }
+
+        /**
+         * @brief Returns the policy, e.g. to set weighted fair queueing weights.
+         */
+        Priority& get_Priority()
+        {
+            return priority;
+        }
+};
+
+using ShortestChargeQueue = HeapQueue<ShortestChargePriority>;     // Shortest charge time first
+using LowestBatteryQueue = HeapQueue<LowestBatteryPriority>;       // Lowest state of charge first
+using WeightedFairQueue = HeapQueue<WeightedFairPriority>;         // Charger time shared between types by weight
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
+
+#include "VehicleFleet.h"
+#include "Statistics.h"
+#include "ChargerManager.h"
+#include "StatisticsShards.h"
+#include "ThreadPool.h"
+
+/**
+ * @brief A network of independent charging sites (vertiports), each with its own chargers and queue.
+ * 
+ * Every vehicle belongs to one home site and only ever charges there, so sites never
+ * interact within a tick. charge_Update splits the sites into one contiguous shard per
+ * thread and updates the shards concurrently: each site writes only its own vehicles'
+ * fleet entries and, for the update, logs into its own padded Statistics shard, merged
+ * into the shared Statistics in site order afterwards, so results do not depend on the
+ * thread count. Requests and releases log straight into the shared Statistics.
+ * 
+ * A vehicle with no explicit home site belongs to site id % site_Count(). A default
+ * network is a single site, which behaves exactly like one ChargerManager.
+ */
+class ChargingNetwork{
+    private:
+        std::vector<std::unique_ptr<ChargerManager>> sites;     // Chargers and wait queue of every site, indexed by site id
+        StatisticsShards site_Stats;                            // Charges and waits logged by each site during an update
+        std::pmr::vector<int> home_Site;                        // Explicit home site of each vehicle, -1 for the default
+        size_t thread_Count = 1;                                // Threads charge_Update may use
+        double clock = 0.0;                                     // Current time, handed to a site before it is used
+        std::unique_ptr<ThreadPool> pool;                       // Workers for the parallel update, created on first use
+
+        Statistics& stats;                                      // Reference to the global Statistics object
+        VehicleFleet& fleet;                                    // Reference to the fleet holding vehicle state
+
+        void update_Sites(size_t begin, size_t end, double time_increment);    // Updates a shard of sites
+        ChargerManager& home(int id);                                           // Home site of a vehicle, with its clock brought up to date
+        bool check_Fleet() const;                                               // Checks that every vehicle's charger state matches its home site
+
+    public:
+        ChargingNetwork(Statistics& statsRef, VehicleFleet& fleetRef, int chargers_Available = 3);   // Creates a single site
+
+        void set_Sites(const std::vector<int> &charger_Counts);             // Replaces the network with one site per charger count
+        void set_HomeSite(int id, int site);                                // Assigns a vehicle to a site
+        void set_Threads(size_t threads);                                   // Sets how many threads charge_Update may use
+        void set_Clock(double time);                                        // Sets the current time used to measure queue waits
+        size_t site_Count() const;                                          // Number of sites
+        int site_Of(int id) const;                                          // Home site of a vehicle
+        ChargerManager& site(int index);                                    // Chargers of one site
+
+        void charge_Request(int id);                                        // Requests a charger at the vehicle's home site
+        void charge_Request(const int *ids, size_t count);                  // Requests chargers for several vehicles in order
+        void charge_Update(double time_increment);                          // Progresses charging at every site
+        bool charger_Availability() const;                                  // Checks if any site has a free charger
+        bool is_Charging(int id) const;                                     // Checks if a vehicle currently occupies a charger
+        bool is_Waiting(int id) const;                                      // Checks if a vehicle is queued for a charger
+        size_t queue_Length() const;                                        // Vehicles waiting across every site
+        int charge_Release(int id);                                         // Frees a vehicle's charger and promotes the next vehicle queued at its site
+        void sync();                                                        // Brings every charging vehicle's battery up to the current time
+        void reset();                                                       // Empties every site's chargers and queue
+        void save(CheckpointWriter &out) const;                             // Writes every site, the home sites and the clock to a checkpoint
+        bool load(CheckpointReader &in);                                    // Replaces the sites with those read from a checkpoint
+};
\ No newline at end of file
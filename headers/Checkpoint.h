@@ -0,0 +1,146 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "MappedFile.h"
+
+/**
+ * @brief Fixed header at the start of every checkpoint file.
+ *
+ * The header is followed by body_Bytes bytes of state, written section by section by the
+ * save() function of each class in the order Simulation::save_Checkpoint calls them.
+ * Scalars are stored as raw bytes and vectors as a uint64_t element count followed by the
+ * elements, so a checkpoint is only read back on a machine with the same byte order.
+ */
+struct CheckpointHeader{
+    char magic[8];              // "EVCHKPT" followed by a zero byte
+    uint32_t version;           // Format version, currently 3
+    uint32_t byte_Order;        // 0x01020304 as written by the saving machine
+    uint64_t body_Bytes;        // Size of the state following the header
+};
+
+/**
+ * @brief Collects simulation state into one buffer and writes it out as a checkpoint file.
+ *
+ * Only trivially copyable values and vectors of them are written, each with a single copy.
+ * The same bytes can be kept in memory as an image instead of written to a file. The
+ * buffer starts with room for the header, so handing it over as an image copies nothing.
+ */
+class CheckpointWriter{
+    private:
+        std::vector<char> body;                 // Room for the header, then the state written so far
+
+        CheckpointHeader header() const;        // Header describing the state written so far
+
+    public:
+        CheckpointWriter();                     // Starts an empty state
+
+        /**
+         * @brief Appends one trivially copyable value.
+         */
+        template <class T>
+        void write(const T &value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Checkpoints store raw bytes");
+            const char *p = reinterpret_cast<const char*>(&value);
+            body.insert(body.end(), p, p + sizeof(T));
+        }
+
+        /**
+         * @brief Appends a vector as its element count followed by its elements.
+         */
+        template <class T, class Alloc>
+        void write(const std::vector<T, Alloc> &values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Checkpoints store raw bytes");
+            write(static_cast<uint64_t>(values.size()));
+            const char *p = reinterpret_cast<const char*>(values.data());
+            body.insert(body.end(), p, p + values.size() * sizeof(T));
+        }
+
+        void write(const std::vector<bool> &values) = delete;      // Packed, has no contiguous storage
+        void write(const std::string &text);                       // Appends a string as its length and characters
+        bool save(const std::string &path) const;                  // Writes the header and state to a file
+        std::vector<char> take_Image();                            // Hands over the header and state as the bytes of a checkpoint file
+};
+
+/**
+ * @brief Reads state back from a memory-mapped checkpoint file or an in-memory image.
+ *
+ * Every read is checked against the end of the file. The first failed read marks the
+ * reader bad and every later read fails too, so a caller can read a whole section and
+ * check good() once.
+ */
+class CheckpointReader{
+    private:
+        MappedFile file;                        // The checkpoint, mapped read-only
+        const char *body = nullptr;             // Start of the state after the header
+        size_t length = 0;                      // Bytes of state
+        size_t offset = 0;                      // Bytes of state consumed so far
+        bool ok = false;                        // Whether every read so far succeeded
+
+        /**
+         * @brief Claims the next bytes of the state.
+         *
+         * @return const char* Start of the bytes, or nullptr if fewer remain.
+         */
+        const char* take(uint64_t bytes)
+        {
+            if (!ok || bytes > length - offset)
+            {
+                ok = false;
+                return nullptr;
+            }
+            const char *p = body + offset;
+            offset += static_cast<size_t>(bytes);
+            return p;
+        }
+
+    public:
+        /**
+         * @brief Reads one trivially copyable value.
+         *
+         * @return true if the value was read; false past the end of the state.
+         */
+        template <class T>
+        bool read(T &value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Checkpoints store raw bytes");
+            const char *p = take(sizeof(T));
+            if (p)
+                std::memcpy(&value, p, sizeof(T));
+            return p != nullptr;
+        }
+
+        /**
+         * @brief Replaces a vector with one written by CheckpointWriter.
+         *
+         * @return true if the vector was read; false past the end of the state.
+         */
+        template <class T, class Alloc>
+        bool read(std::vector<T, Alloc> &values)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Checkpoints store raw bytes");
+            uint64_t count = 0;
+            if (!read(count) || count > (length - offset) / sizeof(T))
+                return ok = false;
+
+            values.resize(static_cast<size_t>(count));
+            const char *p = take(count * sizeof(T));
+            if (count > 0)
+                std::memcpy(values.data(), p, static_cast<size_t>(count) * sizeof(T));
+            return true;
+        }
+
+        bool read(std::vector<bool> &values) = delete;             // Packed, has no contiguous storage
+        bool read(std::string &text);                              // Reads a string written by CheckpointWriter
+        bool open(const std::string &path);                        // Maps a checkpoint and checks its header
+        bool open(const char *data, size_t size);                  // Reads an image held in memory by the caller
+        bool good() const;                                         // Whether every read so far succeeded
+        bool at_End() const;                                       // Whether the whole state has been read
+};
\ No newline at end of file
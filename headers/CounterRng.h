@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Stateless counter-based random number generator (Philox4x32-10).
+ *
+ * A draw is a pure function of (seed, replica, stream, counter): the same four values
+ * always give the same number, whatever thread computes it and in whatever order. Each
+ * vehicle uses its id as the stream and only has to remember how many numbers it has
+ * drawn, instead of carrying a full engine state.
+ */
+class CounterRng{
+    public:
+        static constexpr uint32_t fleet_Stream = 0xFFFFFFFFu;     // Stream reserved for drawing the fleet composition
+
+        /**
+         * @brief Runs the ten Philox rounds on one counter block.
+         * @param ctr Counter block.
+         * @param key Key, derived from the seed.
+         * @return Four pseudo-random 32-bit words.
+         */
+        static std::array<uint32_t, 4> philox(std::array<uint32_t, 4> ctr, std::array<uint32_t, 2> key){
+            for (int round = 0; round < 10; ++round)
+            {
+                uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * ctr[0];
+                uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * ctr[2];
+
+                ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<uint32_t>(p1),
+                       static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<uint32_t>(p0)};
+
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            return ctr;
+        }
+
+        /**
+         * @brief Draws a uniform number in [0, 1).
+         * @param seed Global seed of the run.
+         * @param replica Replication the draw belongs to.
+         * @param stream Random stream within the replication, normally the vehicle id.
+         * @param counter Index of the draw within the stream.
+         * @param branch Forked branch the draw belongs to, 0 for a run that was never forked.
+         * @return Uniform double with 53 random bits.
+         */
+        static double uniform(uint64_t seed, uint32_t replica, uint32_t stream, uint32_t counter, uint32_t branch = 0){
+            std::array<uint32_t, 4> out = philox({counter, stream, replica, branch},
+                                                 {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)});
+
+            uint64_t bits = (static_cast<uint64_t>(out[1]) << 32) | out[0];
+            return (bits >> 11) * 0x1.0p-53;
+        }
+};
\ No newline at end of file
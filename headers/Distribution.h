@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "Checkpoint.h"
+
+/**
+ * @brief Mergeable quantile sketch with bounded relative error and bounded memory.
+ *
+ * Positive values are counted in logarithmic buckets whose bounds grow by a factor
+ * gamma = (1 + accuracy) / (1 - accuracy), so any quantile is returned within the
+ * relative accuracy of a true sample value (1% by default). Values at or below
+ * min_Value share a zero bucket. Two sketches with the same accuracy merge exactly by
+ * adding bucket counts, whatever thread or replica filled them. At most max_Buckets
+ * buckets are kept; beyond that the lowest buckets are folded together, which only
+ * affects the accuracy of the smallest quantiles.
+ */
+class QuantileSketch{
+    private:
+        static constexpr double accuracy = 0.01;            // Relative accuracy of every quantile
+        static constexpr double min_Value = 1e-9;           // Values at or below this count as zero
+        static constexpr size_t max_Buckets = 2048;         // Bucket limit, covers about 18 orders of magnitude
+
+        std::vector<uint64_t> buckets;      // Count per logarithmic bucket, starting at bucket index offset
+        int offset = 0;                     // Bucket index of buckets[0]
+        uint64_t zero_Count = 0;            // Values at or below min_Value
+        uint64_t total = 0;                 // Values added
+
+        static int bucket_Of(double value);             // Index of the bucket holding a value
+        static double bucket_Value(int index);          // Representative value of a bucket
+        void add_ToBucket(int index, uint64_t count);   // Adds counts to a bucket, growing or folding the range
+
+    public:
+        void add(double value);                         // Counts one value
+        void merge(const QuantileSketch &other);        // Adds every count of another sketch
+        void clear();                                   // Forgets every value, keeping the bucket memory
+        void save(CheckpointWriter &out) const;         // Writes the buckets and counts to a checkpoint
+        bool load(CheckpointReader &in);                // Replaces the sketch with one read from a checkpoint
+        double quantile(double q) const;                // Value below which a fraction q of the values lie
+        uint64_t count() const;                         // Values added
+        size_t bucket_Count() const;                    // Buckets in use, a measure of memory
+};
+
+/**
+ * @brief Streaming summary of one metric: count, mean, variance, extremes and quantiles.
+ *
+ * Mean and variance use Welford's method and merge with Chan's formula, so a summary can
+ * be built in one pass over any number of values, in pieces, and without storing them.
+ */
+class Distribution{
+    private:
+        uint64_t samples = 0;       // Values added
+        double mean_Value = 0.0;    // Running mean
+        double m2 = 0.0;            // Running sum of squared deviations from the mean
+        double min_Seen = 0.0;      // Smallest value added
+        double max_Seen = 0.0;      // Largest value added
+        QuantileSketch sketch;      // Quantile estimate
+
+    public:
+        void add(double value);                         // Records one value
+        void merge(const Distribution &other);          // Combines another summary into this one
+        void clear();                                   // Forgets every value, keeping the sketch memory
+        void save(CheckpointWriter &out) const;         // Writes the summary and its sketch to a checkpoint
+        bool load(CheckpointReader &in);                // Replaces the summary with one read from a checkpoint
+
+        uint64_t count() const;                         // Values recorded
+        double mean() const;                            // Mean of the values
+        double variance() const;                        // Unbiased sample variance
+        double stddev() const;                          // Sample standard deviation
+        double min() const;                             // Smallest value
+        double max() const;                             // Largest value
+        double quantile(double q) const;                // Approximate q-quantile, clamped to [min, max]
+        std::string percentiles() const;                // Formats the p50, p95 and p99 for reports
+        const QuantileSketch& get_Sketch() const;       // Getter function to get the underlying sketch
+};
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Kinds of events processed by the discrete-event simulation engine.
+ */
+enum class EventType{
+    Depletion,          // Vehicle battery runs out and the flight ends
+    Fault,              // Vehicle encounters a fault while airborne
+    ChargeComplete      // Vehicle finishes charging and the charger is released
+};
+
+/**
+ * @brief A single timestamped event for one vehicle.
+ */
+struct SimEvent{
+    double time;            // Simulation time at which the event fires (hours)
+    EventType type;         // What happens at that time
+    int vehicle;            // Index of the vehicle the event belongs to
+    uint64_t sequence;      // Insertion order, breaks ties between events at the same time
+};
+
+/**
+ * @brief Min-priority queue of simulation events ordered by time.
+ *
+ * Events with equal timestamps are returned in the order they were pushed so
+ * that a run is fully determined by its random draws. The events are kept as a binary
+ * heap in one array allocated from the given memory resource; clear() keeps its capacity,
+ * so a queue reused across runs stops allocating once it has seen its largest backlog.
+ */
+class EventQueue{
+    private:
+        struct Later{
+            bool operator()(const SimEvent &a, const SimEvent &b) const{
+                return a.time != b.time ? a.time > b.time : a.sequence > b.sequence;
+            }
+        };
+
+        std::pmr::vector<SimEvent> events;      // Pending events as a heap, earliest at the front
+        uint64_t next_Sequence = 0;             // Sequence number given to the next pushed event
+
+    public:
+        explicit EventQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource());   // Creates an empty queue allocating from resource
+
+        void push(double time, EventType type, int vehicle);    // Schedules an event
+        SimEvent pop();                                         // Removes and returns the earliest event
+        const SimEvent& top() const;                            // Returns the earliest event without removing it
+        bool empty() const;                                     // Checks if any events are pending
+        size_t size() const;                                    // Number of pending events
+        void clear();                                           // Drops all pending events
+};
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+
+#include "Vehicle.h"
+
+/**
+ * @brief Kinds of events recorded in a trace.
+ */
+enum class TraceKind : uint8_t{
+    FlightEnd,      // Battery ran out; value is the flight time of the session (hours)
+    Enqueue,        // Vehicle joined its site's charger queue; value is that queue's length after joining
+    ChargeStart,    // Vehicle took a charger; value is the time it waited in the queue (hours)
+    ChargeEnd,      // Vehicle left a full charge; value is the time it spent on the charger (hours)
+    Fault           // Vehicle had a fault; value is its cruise speed after degradation
+};
+
+/**
+ * @brief Fixed header at the start of every trace file.
+ *
+ * The header is followed by type_Count names of name_Bytes bytes each, zero padded, and
+ * then by fixed-size blocks starting at data_Offset. Every block holds block_Events slots
+ * stored column by column:
+ *
+ *     uint64_t count                    events used in this block
+ *     double   time[block_Events]       simulation time (hours)
+ *     double   value[block_Events]      meaning depends on kind, see TraceKind
+ *     int32_t  vehicle[block_Events]    fleet id
+ *     int16_t  type[block_Events]       TypeId
+ *     uint8_t  kind[block_Events]       TraceKind
+ *
+ * padded to a multiple of 8 bytes. Only the last block may be partly filled. Events are
+ * written in time order, so a time window can be found by binary search over the blocks.
+ */
+struct TraceHeader{
+    char magic[8];              // "EVTRACE" followed by a zero byte
+    uint32_t version;           // Format version, currently 1
+    uint32_t block_Events;      // Event slots per block
+    uint32_t type_Count;        // Number of type names following the header
+    uint32_t name_Bytes;        // Bytes reserved for each type name
+    uint64_t data_Offset;       // File offset of the first block
+};
+
+/**
+ * @brief Byte offsets of the columns inside one trace block.
+ */
+struct TraceLayout{
+    size_t time;                // Offset of the time column
+    size_t value;               // Offset of the value column
+    size_t vehicle;             // Offset of the vehicle column
+    size_t type;                // Offset of the type column
+    size_t kind;                // Offset of the kind column
+    size_t block_Bytes;         // Size of a whole block
+
+    static TraceLayout for_Block(uint32_t block_Events);    // Computes the offsets for a block size
+};
+
+/**
+ * @brief Appends simulation events to a columnar binary trace file.
+ *
+ * Events are collected column by column in a single in-memory block and written out when
+ * the block is full, so recording an event is a handful of stores. Read traces back with
+ * TraceReader or the evtol-trace tool.
+ */
+class EventTrace{
+    private:
+        std::ofstream file;                     // Destination of the trace
+        TraceLayout layout{};                   // Column offsets of a block
+        uint32_t block_Events = 0;              // Event slots per block
+
+        std::vector<double> time;               // Columns of the block being filled
+        std::vector<double> value;
+        std::vector<int32_t> vehicle;
+        std::vector<int16_t> type;
+        std::vector<uint8_t> kind;
+        uint64_t count = 0;                     // Events in the block being filled
+        uint64_t total = 0;                     // Events recorded since open
+
+        void write_Block();                     // Writes the current block and starts a new one
+
+    public:
+        static const uint32_t default_BlockEvents = 4096;   // Block size used unless open is told otherwise
+        static const uint32_t name_Bytes = 32;              // Bytes stored per type name
+
+        EventTrace() = default;
+        ~EventTrace();                                      // Writes the last block and closes the file
+
+        EventTrace(const EventTrace&) = delete;
+        EventTrace& operator=(const EventTrace&) = delete;
+
+        bool open(const std::string &path, const std::vector<std::string> &type_Names,
+                  uint32_t block_Events = default_BlockEvents);                     // Starts a new trace file
+        void record(double time, TraceKind kind, int vehicle, TypeId type, double value);   // Appends one event
+        void close();                                                               // Writes the last block and closes the file
+
+        bool is_Open() const;                   // Whether events are being recorded
+        uint64_t get_Count() const;             // Events recorded since open
+};
\ No newline at end of file
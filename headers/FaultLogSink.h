@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+
+#include "Vehicle.h"
+
+/**
+ * @brief Fixed-size binary record of a single fault.
+ */
+struct FaultRecord{
+    double time;            // Simulation time of the fault (hours)
+    double cruise_Speed;    // Cruise speed after degradation
+    TypeId type;            // Registered type of the vehicle
+    int vehicle;            // Fleet id of the vehicle
+    int fault_Count;        // Faults the vehicle has had so far, including this one
+    int reserved;           // Padding, always zero, keeps the record at 32 bytes
+};
+
+/**
+ * @brief File layout written by the FaultLogSink.
+ */
+enum class FaultLogFormat{
+    Text,       // One "[FAULT] Time: ... | Degradation: ..." line per fault, as fault_log.txt always had
+    Binary      // FaultRecord structs back to back, in native byte order
+};
+
+/**
+ * @brief What a producer does when its ring buffer is full.
+ */
+enum class FaultLogBackpressure{
+    Block,      // Wait for the writer to make room, no record is lost
+    Drop        // Discard the record and count it, the simulation never waits
+};
+
+/**
+ * @brief Asynchronous fault log.
+ *
+ * Simulation threads push fixed-size FaultRecords into a lock-free single-producer ring
+ * owned by the calling thread, so logging a fault is a copy and an atomic store. A background
+ * writer thread drains every ring in batches, formats them with std::to_chars (or copies them
+ * out unchanged in binary mode) and writes each batch with one call. Memory is bounded by the
+ * ring capacity per producing thread. Records from one thread keep their order; records from
+ * different threads are interleaved batch by batch.
+ */
+class FaultLogSink{
+    private:
+        struct Ring{
+            std::vector<FaultRecord> slots;                 // Capacity is a power of two
+            size_t mask;                                    // slots.size() - 1
+            alignas(64) std::atomic<size_t> head{0};        // Next record the writer reads, written by the writer only
+            alignas(64) std::atomic<size_t> tail{0};        // Next free slot, written by the producer only
+        };
+
+        std::vector<std::unique_ptr<Ring>> rings;           // One ring per producing thread
+        std::vector<std::thread::id> ring_Owners;           // Thread that owns each ring
+        std::mutex rings_Lock;                              // Guards rings and ring_Owners, taken only to register a thread
+
+        std::ofstream file;                                 // Destination of the log
+        std::vector<std::string> type_Names;                // Names printed for each TypeId in text mode
+        std::thread writer;                                 // Background thread draining the rings
+
+        std::mutex wake_Lock;                               // Guards the flags below
+        std::condition_variable wake;                       // Wakes the writer early
+        std::condition_variable drained;                    // Signalled after the writer finishes a batch
+        bool wake_Requested = false;                        // A producer or flush asked for a drain
+        bool stop_Requested = false;                        // close() asked the writer to finish
+        uint64_t written = 0;                               // Records written so far, guarded by wake_Lock
+
+        std::atomic<uint64_t> dropped{0};                   // Records discarded under FaultLogBackpressure::Drop
+        std::atomic<bool> opened{false};                    // Whether push accepts records
+        uint64_t sink_Id = 0;                               // Changes on every open, invalidates cached thread rings
+
+        FaultLogFormat format = FaultLogFormat::Text;
+        FaultLogBackpressure backpressure = FaultLogBackpressure::Block;
+        size_t capacity = 4096;                             // Records per ring
+
+        Ring* ring_ForThisThread();                         // Finds or creates the calling thread's ring
+        size_t drain(std::string &buffer, std::vector<FaultRecord> &batch);   // Writes out every ring once, returns records written
+        void append_Text(std::string &buffer, const FaultRecord &r) const;    // Formats one record as a text line
+        void writer_Loop();                                 // Body of the writer thread
+
+    public:
+        FaultLogSink() = default;
+        ~FaultLogSink();                                    // Writes out pending records and closes the file
+
+        FaultLogSink(const FaultLogSink&) = delete;
+        FaultLogSink& operator=(const FaultLogSink&) = delete;
+
+        void set_Format(FaultLogFormat format);                     // Text or binary records, set while the sink is closed
+        void set_Backpressure(FaultLogBackpressure policy);         // Block or drop when a ring is full
+        void set_Capacity(size_t records);                          // Ring size per thread, rounded up to a power of two
+
+        bool open(const std::string &path, const std::vector<std::string> &type_Names);   // Starts logging to a file
+        void push(const FaultRecord &record);                       // Logs a fault from the calling thread
+        void flush();                                               // Blocks until every pushed record is written
+        void close();                                               // Writes out pending records and stops the writer
+
+        bool is_Open() const;                                       // Whether records are being accepted
+        uint64_t get_Dropped() const;                               // Records discarded because a ring was full
+        uint64_t get_Written();                                     // Records written to the file so far
+        FaultLogFormat get_Format() const;                          // Current file layout
+};
\ No newline at end of file
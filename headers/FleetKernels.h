@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+#include "CertifiedTypes.h"
+
+/**
+ * @brief Batch flight and charging kernels over contiguous fleet arrays.
+ *
+ * Every vehicle in a batch is advanced with the same branch-free arithmetic: the
+ * full-flight / partial-flight choice, the grounded check and the capacity cap are
+ * computed for all vehicles and blended with masks. Builds with AVX2 enabled
+ * (-mavx2 or -march=native) process four vehicles per instruction; other builds use
+ * a scalar loop with the same arithmetic, which compilers can auto-vectorize.
+ *
+ * Each type in certified_Types also has its own instantiation of both kernels, with the
+ * type's parameters compiled in as constants, for batches of vehicles of one type.
+ */
+class FleetKernels{
+    public:
+        static void fly(double *battery, const double *speed, const double *energy, const int *passengers,
+                        double *session_Time, double *session_Distance, int *session_PassengerMiles,
+                        size_t n, double time_increment);                                   // Flies n vehicles, grounded ones stay put
+
+        static void charge(double *battery, const double *rate, const double *capacity,
+                           double *charging_Time, size_t n, double time_increment);          // Charges n vehicles, capped at capacity
+
+        static void fly_Certified(size_t type, double *battery, const double *speed,
+                                  double *session_Time, double *session_Distance, int *session_PassengerMiles,
+                                  size_t n, double time_increment);                          // Flies n vehicles of one certified type
+
+        static void charge_Certified(size_t type, double *battery, double *charging_Time,
+                                     size_t n, double time_increment);                       // Charges n vehicles of one certified type
+
+        static bool simd_Enabled();                                                          // Whether this build uses the AVX2 path
+};
\ No newline at end of file
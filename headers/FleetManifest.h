@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#include "Vehicle.h"
+
+/**
+ * @brief A run of consecutive vehicles of the same type in a manifest.
+ */
+struct ManifestRun{
+    size_t type;            // Index into FleetManifest::types
+    uint64_t count;         // Number of vehicles in the run
+};
+
+/**
+ * @brief Reads vehicle types and fleet composition from a CSV or JSON manifest.
+ *
+ * The file is memory-mapped and parsed in place: fields are string_views into the mapping
+ * and numbers are read with std::from_chars, so rows cost no allocation. Consecutive
+ * vehicles of the same type collapse into one ManifestRun, which keeps a manifest with
+ * millions of per-vehicle rows down to a handful of runs and lets the caller size the fleet
+ * before building it.
+ *
+ * CSV manifests hold one record per line, the first field naming its kind:
+ *
+ *     type,<name>,<cruise speed>,<battery capacity>,<time to charge>,<energy per mile>,<passengers>,<fault probability>
+ *     fleet,<type name>,<count>
+ *     vehicle,<type name>
+ *
+ * Blank lines and lines starting with # are ignored. JSON manifests are a single object:
+ *
+ *     {"types": [{"name": ..., "cruise_speed": ..., "battery_capacity": ..., "time_to_charge": ...,
+ *                 "energy_per_mile": ..., "passenger_count": ..., "fault_probability": ...}],
+ *      "fleet": [{"type": ..., "count": ...}],
+ *      "vehicles": ["<type name>", ...]}
+ *
+ * Types may be referenced before they are defined; vehicles from "fleet" come before those
+ * from "vehicles" only if the keys appear in that order.
+ */
+class FleetManifest{
+    private:
+        std::vector<std::pair<std::string_view, uint64_t>> pending_Runs;   // Runs by type name until every type is known
+
+        bool parse_Csv(std::string_view text);                              // Parses the CSV layout
+        bool parse_Json(std::string_view text);                             // Parses the JSON layout
+        bool add_Type(std::string_view name, double cruiseSpeed, double battery_Capacity, double timeTo_Charge,
+                      double energy_PerMile, double passenger_Count, double fault_Probability);   // Validates and stores a type
+        void add_Run(std::string_view name, uint64_t count);                // Appends vehicles, merging with the previous run
+        bool resolve_Runs();                                                // Turns type names into indices into types
+        bool fail(const std::string &message);                              // Records the first error and returns false
+
+    public:
+        std::vector<Vehicle> types;             // Vehicle types in file order
+        std::vector<ManifestRun> composition;   // Fleet as runs of vehicles, in file order
+        std::string error;                      // First problem found, empty if the last parse succeeded
+
+        bool load(const std::string &path);     // Maps and parses a manifest file
+        bool parse(std::string_view text);      // Parses a manifest already in memory, JSON if it starts with '{'
+        uint64_t vehicle_Count() const;         // Total vehicles described by the composition
+};
\ No newline at end of file
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "Checkpoint.h"
+
+/**
+ * @brief Min-heap of vehicle ids keyed by a double, with an index from id to heap position.
+ *
+ * Each node has Arity children, so the heap is shallower than a binary one and a sift
+ * touches fewer cache lines. The position index lets a queued vehicle's key be changed or
+ * the vehicle removed in O(log n) without searching. Equal keys come out in insertion
+ * order. Every id may be in the heap at most once.
+ *
+ * @tparam Arity Children per node, at least 2.
+ */
+template <int Arity = 4>
+class IndexedHeap{
+    static_assert(Arity >= 2, "IndexedHeap needs at least two children per node");
+
+    private:
+        struct Entry{
+            double key;             // Priority, smallest first
+            uint64_t sequence;      // Insertion order, breaks ties between equal keys
+            int id;                 // Vehicle id
+        };
+
+        std::pmr::vector<Entry> entries;    // The heap, root at index 0
+        std::pmr::vector<int> position;     // Heap index of each id, -1 if absent
+        uint64_t next_Sequence = 0;         // Sequence number given to the next pushed id
+
+        /**
+         * @brief Checks whether one entry must sit above another.
+         */
+        static bool before(const Entry &a, const Entry &b)
+        {
+            return a.key != b.key ? a.key < b.key : a.sequence < b.sequence;
+        }
+
+        /**
+         * @brief Writes an entry into a heap slot and records its position.
+         */
+        void place(size_t index, const Entry &e)
+        {
+            entries[index] = e;
+            position[e.id] = static_cast<int>(index);
+        }
+
+        /**
+         * @brief Grows the position index to cover an id, without reserving heap entries for it.
+         */
+        void index_Id(int id)
+        {
+            if (static_cast<size_t>(id) >= position.size())
+                position.resize(static_cast<size_t>(id) + 1, -1);
+        }
+
+        /**
+         * @brief Moves the entry at index towards the root until its parent comes before it.
+         */
+        void sift_Up(size_t index)
+        {
+            Entry e = entries[index];
+            while (index > 0)
+            {
+                size_t parent = (index - 1) / Arity;
+                if (!before(e, entries[parent]))
+                    break;
+                place(index, entries[parent]);
+                index = parent;
+            }
+            place(index, e);
+        }
+
+        /**
+         * @brief Moves the entry at index towards the leaves until it comes before all its children.
+         */
+        void sift_Down(size_t index)
+        {
+            Entry e = entries[index];
+            size_t n = entries.size();
+            while (true)
+            {
+                size_t first = index * Arity + 1;
+                if (first >= n)
+                    break;
+
+                size_t last = first + Arity < n ? first + Arity : n;
+                size_t best = first;
+                for (size_t c = first + 1; c < last; ++c)
+                {
+                    if (before(entries[c], entries[best]))
+                        best = c;
+                }
+                if (!before(entries[best], e))
+                    break;
+                place(index, entries[best]);
+                index = best;
+            }
+            place(index, e);
+        }
+
+    public:
+        /**
+         * @brief Creates an empty heap.
+         *
+         * @param resource Memory the heap and the position index allocate from.
+         */
+        explicit IndexedHeap(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+            : entries(resource), position(resource) {}
+
+        /**
+         * @brief Sizes the position index for ids below count and the heap for count entries.
+         *
+         * @param count Number of distinct ids that may be pushed.
+         */
+        void reserve(size_t count)
+        {
+            reserve(count, count);
+        }
+
+        /**
+         * @brief Sizes the position index for ids below count and the heap for capacity entries.
+         *
+         * For a heap that holds only a few of many possible ids, e.g. the vehicles on a charger.
+         *
+         * @param count Number of distinct ids that may be pushed.
+         * @param capacity Number of ids that may be in the heap at once.
+         */
+        void reserve(size_t count, size_t capacity)
+        {
+            if (position.size() < count)
+                position.resize(count, -1);
+            entries.reserve(capacity);
+        }
+
+        /**
+         * @brief Inserts an id with a key.
+         *
+         * @param id Id not already in the heap.
+         * @param key Priority, smallest is popped first.
+         */
+        void push(int id, double key)
+        {
+            index_Id(id);
+            entries.push_back(Entry{key, next_Sequence++, id});
+            sift_Up(entries.size() - 1);
+        }
+
+        /**
+         * @brief Removes and returns the id with the smallest key.
+         *
+         * @return int The top id; the heap must not be empty.
+         */
+        int pop()
+        {
+            int id = entries[0].id;
+            remove(id);
+            return id;
+        }
+
+        /**
+         * @brief Removes an id wherever it sits in the heap.
+         *
+         * @param id Id to remove; ignored if absent.
+         */
+        void remove(int id)
+        {
+            if (!contains(id))
+                return;
+
+            size_t index = position[id];
+            position[id] = -1;
+
+            Entry last = entries.back();
+            entries.pop_back();
+            if (index == entries.size())
+                return;
+
+            place(index, last);
+            if (index > 0 && before(last, entries[(index - 1) / Arity]))
+                sift_Up(index);
+            else
+                sift_Down(index);
+        }
+
+        /**
+         * @brief Changes the key of an id already in the heap, keeping its place among equal keys.
+         *
+         * @param id Id in the heap; ignored if absent.
+         * @param key New priority.
+         */
+        void update(int id, double key)
+        {
+            if (!contains(id))
+                return;
+
+            size_t index = position[id];
+            double old = entries[index].key;
+            entries[index].key = key;
+            if (key < old)
+                sift_Up(index);
+            else
+                sift_Down(index);
+        }
+
+        /**
+         * @brief Checks whether an id is in the heap.
+         */
+        bool contains(int id) const
+        {
+            return id >= 0 && static_cast<size_t>(id) < position.size() && position[id] >= 0;
+        }
+
+        /**
+         * @brief Returns the id with the smallest key without removing it.
+         */
+        int top() const
+        {
+            return entries[0].id;
+        }
+
+        /**
+         * @brief Returns the smallest key in the heap.
+         */
+        double top_Key() const
+        {
+            return entries[0].key;
+        }
+
+        /**
+         * @brief Returns the id at a heap index, e.g. to visit every id in no particular order.
+         *
+         * @param index Heap index, below size().
+         */
+        int at(size_t index) const
+        {
+            return entries[index].id;
+        }
+
+        /**
+         * @brief Returns the number of ids in the heap.
+         */
+        size_t size() const
+        {
+            return entries.size();
+        }
+
+        /**
+         * @brief Checks if the heap is empty.
+         */
+        bool empty() const
+        {
+            return entries.empty();
+        }
+
+        /**
+         * @brief Writes the heap to a checkpoint in its current layout.
+         *
+         * @param out Checkpoint being written.
+         */
+        void save(CheckpointWriter &out) const
+        {
+            out.write(entries);
+            out.write(next_Sequence);
+        }
+
+        /**
+         * @brief Replaces the heap with one written by save() and rebuilds the position index.
+         *
+         * Entries keep their layout and sequence numbers, so ties break as they would have.
+         *
+         * @param in Checkpoint positioned at the heap.
+         * @param id_Limit Every id must be below this.
+         * @return true if the heap was read and holds each valid id at most once; false otherwise.
+         */
+        bool load(CheckpointReader &in, size_t id_Limit)
+        {
+            std::fill(position.begin(), position.end(), -1);
+            if (!in.read(entries) || !in.read(next_Sequence))
+            {
+                entries.clear();
+                return false;
+            }
+
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                int id = entries[i].id;
+                if (id < 0 || static_cast<size_t>(id) >= id_Limit || contains(id))
+                {
+                    clear();
+                    return false;
+                }
+                index_Id(id);
+                position[id] = static_cast<int>(i);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Removes every id, keeping the reserved capacity.
+         */
+        void clear()
+        {
+            for (const Entry &e : entries)
+            {
+                position[e.id] = -1;
+            }
+            entries.clear();
+            next_Sequence = 0;
+        }
+};
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Read-only view of a whole file.
+ *
+ * The file is memory-mapped where the platform supports it, so nothing is copied and pages
+ * are read from disk only when touched. Elsewhere the file is read into memory once.
+ */
+class MappedFile{
+    private:
+        const char *bytes = nullptr;        // Start of the file contents
+        size_t length = 0;                  // Size of the file in bytes
+        bool mapped = false;                // Whether bytes points at a mapping rather than fallback
+        std::vector<char> fallback;         // File contents when it cannot be mapped
+
+    public:
+        MappedFile() = default;
+        ~MappedFile();                      // Unmaps the file
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool open(const std::string &path); // Maps a file, false if it cannot be read
+        void close();                       // Unmaps the file
+
+        const char* data() const;           // First byte of the file
+        size_t size() const;                // Size of the file in bytes
+};
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+
+#include "FleetManifest.h"
+#include "ReplicationRunner.h"
+
+/**
+ * @brief One parameter varied by a sweep, with the values or range it takes.
+ */
+struct SweepAxis{
+    std::string name;               // Parameter name, see ParameterSweep
+    std::vector<double> values;     // Values of a grid axis, empty for a sampled range
+    double low = 0.0;               // Lower end of a sampled range
+    double high = 0.0;              // Upper end of a sampled range
+};
+
+/**
+ * @brief Fleet-wide estimates at one point of a sweep, over its replications.
+ */
+struct SweepResult{
+    std::vector<double> values;     // Value of each axis at the point, in axis order
+    Estimate passenger_Miles;       // Total passenger miles per replication
+    Estimate flights;               // Flights per replication
+    Estimate flight_Hours;          // Flight hours per replication
+    Estimate faults;                // Faults per replication
+    Estimate charges;               // Charging sessions per replication
+    Estimate queue_Wait;            // Mean charger queue wait per replication, over replications where a vehicle queued
+    Estimate queue_Wait95;          // 95th percentile charger queue wait per replication, same replications
+};
+
+/**
+ * @brief Runs a simulation at every point of a parameter grid or Latin-hypercube sample.
+ *
+ * Starting from a base manifest, each axis changes one parameter of the scenario:
+ *
+ *     chargers                  Chargers at every site (base 3)
+ *     sites                     Charging sites (base 1)
+ *     fleet_size                Total vehicles, split over the types by the mix (base: manifest count)
+ *     mix.<type>                Relative weight of a type in the fleet (base: its manifest count)
+ *     time_increment            Length of a tick in hours (base 0.5)
+ *     sim_time                  Simulated hours (base 3)
+ *     <type>.cruise_speed, <type>.battery_capacity, <type>.time_to_charge,
+ *     <type>.energy_per_mile, <type>.passenger_count, <type>.fault_probability
+ *
+ * Grid axes list their values and are crossed with one another. Range axes are sampled
+ * together by a Latin hypercube of set_Samples points, which is crossed with the grid.
+ * Counts are rounded to whole numbers. Values are checked when an axis is added: ticks,
+ * durations, speeds, capacities, charge times and energy use must be positive, sites at
+ * least 1 and the rest non-negative. Counts, like samples and replications, are at most
+ * INT_MAX. Every point x replication is a separate task on a thread pool; replication r
+ * of every point uses the random streams (seed, r), so points are compared on common
+ * random numbers. Results are folded in point and replication order and do not depend on
+ * the thread count.
+ *
+ * A sweep can also be read from a CSV spec, one record per line:
+ *
+ *     grid,<parameter>,<value>,<value>,...
+ *     range,<parameter>,<low>,<high>
+ *     samples,<count>
+ *     replications,<count>
+ */
+class ParameterSweep{
+    private:
+        static constexpr uint32_t sample_Replica = 0xFFFFFFFFu;    // Replica id of the random numbers drawing the Latin hypercube
+
+        FleetManifest base;                     // Scenario every point starts from
+        std::vector<SweepAxis> axes;            // Parameters varied, in table column order
+        size_t samples = 1;                     // Latin-hypercube points drawn over the range axes
+        int replications = 1;                   // Independent runs at every point
+        size_t thread_Count;                    // Number of worker threads
+        bool event_Driven;                      // Whether points run the event-driven engine
+        uint64_t seed;                          // Global seed of every run and of the sample
+        std::vector<SweepResult> results;       // Estimates at every point, in point order
+
+        bool check_Name(const std::string &name);      // Checks that an axis names a known parameter
+        bool check_Values(const std::string &name, const std::vector<double> &values);   // Checks that values are valid for the parameter
+        bool fail(const std::string &message);         // Records the first error and returns false
+
+    public:
+        std::string error;                      // First problem found, empty if the last call succeeded
+
+        ParameterSweep(const FleetManifest &base, size_t threads = std::thread::hardware_concurrency(), bool event_Driven = false);    // Constructor function for class ParameterSweep
+
+        bool add_Grid(const std::string &name, std::vector<double> values);    // Adds an axis taking each listed value
+        bool add_Range(const std::string &name, double low, double high);      // Adds an axis sampled from [low, high)
+        void set_Samples(size_t count);                                        // Sets the Latin-hypercube points over the range axes
+        void set_Replications(int count);                                      // Sets the runs at every point
+        void set_Seed(uint64_t seed);                                          // Makes the sample and every run reproducible
+        bool parse(std::string_view text);                                     // Adds the axes and settings of a CSV spec
+        bool load(const std::string &path);                                    // Maps and parses a CSV spec file
+
+        std::vector<std::vector<double>> points() const;                       // Axis values of every point, in run order
+        void run();                                                            // Runs every point x replication and keeps the estimates
+        const std::vector<SweepResult>& get_Results() const;                   // Getter function to get the estimates at every point
+        void write_Table(std::ostream &out) const;                             // Writes the results as one CSV table
+        bool save_Table(const std::string &path) const;                        // Writes the results table to a file
+};
\ No newline at end of file
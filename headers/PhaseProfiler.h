@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Parts of a run whose time the profiler accounts separately.
+ */
+enum class Phase : uint8_t{
+    Run,            // A whole run_Sim or run_EventSim call
+    Fly,            // Depletion flags and the batch flight kernel
+    Faults,         // Fault draws and flight-end handling, includes FaultLog
+    FaultLog,       // Handing fault records to the fault log and trace
+    Chargers,       // Collecting charge requests and updating the chargers
+    Trace,          // Tracing charger state changes after the charger update
+    Settle,         // Post-charge wasCharging bookkeeping and charge logging
+    Merge,          // Folding the per-chunk statistics into the run's
+    Events,         // Handling events in the event-driven engine
+    Count           // Number of phases, not a phase
+};
+
+/**
+ * @brief Events the profiler counts during a run.
+ */
+enum class Counter : uint8_t{
+    Ticks,          // Fixed-step ticks taken
+    Flights,        // Flights ended
+    Faults,         // Faults recorded
+    ChargeRequests, // Vehicles handed to the chargers
+    Charges,        // Charging sessions logged by the simulation loop, not by the chargers
+    Events,         // Events handled by the event-driven engine
+    Count           // Number of counters, not a counter
+};
+
+/**
+ * @brief Low-overhead timers and counters for the phases of a simulation run.
+ *
+ * Instrumentation is written with the PROFILE_PHASE and PROFILE_COUNT macros below, which
+ * expand to nothing unless the simulator is built with -DEVTOL_PROFILE, so a normal build
+ * carries no timers, counters or allocation hooks. The class itself has the same layout in
+ * every build. Phases that run on several tick threads add up the time of every thread, so
+ * their share of the run can exceed 100%. A profiling build also counts the operator new
+ * calls made by the thread inside each phase and, on Linux, can read the cycle and cache-miss
+ * hardware counters of that thread through perf_event_open.
+ */
+class PhaseProfiler{
+    private:
+        /**
+         * @brief Totals of one phase, updated by whichever thread ran it.
+         */
+        struct PhaseTotals{
+            std::atomic<uint64_t> nanoseconds{0};       // Time spent in the phase
+            std::atomic<uint64_t> calls{0};             // Times the phase was entered
+            std::atomic<uint64_t> allocations{0};       // operator new calls made inside the phase
+            std::atomic<uint64_t> cycles{0};            // CPU cycles, when hardware counters are on
+            std::atomic<uint64_t> cache_Misses{0};      // Cache misses, when hardware counters are on
+        };
+
+        PhaseTotals phases[static_cast<size_t>(Phase::Count)];          // Totals of each phase
+        std::atomic<uint64_t> counters[static_cast<size_t>(Counter::Count)] = {};     // Value of each counter
+        std::atomic<uint64_t> queue_Total{0};       // Sum of the sampled charger queue depths
+        std::atomic<uint64_t> queue_Samples{0};     // Number of queue depth samples
+        std::atomic<uint64_t> queue_Peak{0};        // Deepest sampled charger queue
+        bool hardware = false;                      // Whether phases read the hardware counters
+        std::atomic<bool> hardware_Available{false};  // Whether a phase managed to read the hardware counters
+
+        friend class PhaseScope;
+
+    public:
+        void reset();                                           // Zeroes every timer and counter
+        void set_HardwareCounters(bool enabled);                // Reads cycles and cache misses per phase where supported
+        void count(Counter counter, uint64_t amount = 1);       // Adds to a counter
+        void sample_Queue(size_t depth);                        // Records the charger queue depth
+
+        uint64_t nanoseconds(Phase phase) const;                // Time spent in a phase
+        uint64_t calls(Phase phase) const;                      // Times a phase was entered
+        uint64_t allocations(Phase phase) const;                // operator new calls made inside a phase
+        uint64_t value(Counter counter) const;                  // Value of a counter
+        double queue_Mean() const;                              // Mean sampled charger queue depth
+        uint64_t queue_Max() const;                             // Deepest sampled charger queue
+
+        void print(std::ostream &out) const;                    // Prints the phase table and counters
+
+        static uint64_t thread_Allocations();                   // operator new calls made by this thread, 0 unless profiling
+};
+
+/**
+ * @brief Times one entry into a phase and adds it to a profiler when it goes out of scope.
+ */
+class PhaseScope{
+    private:
+        PhaseProfiler &profiler;                            // Profiler receiving the totals
+        Phase phase;                                        // Phase being timed
+        std::chrono::steady_clock::time_point start;        // When the phase was entered
+        uint64_t allocations;                               // Thread's allocation count when the phase was entered
+        uint64_t cycles = 0;                                // Thread's cycle count when the phase was entered
+        uint64_t cache_Misses = 0;                          // Thread's cache-miss count when the phase was entered
+
+    public:
+        PhaseScope(PhaseProfiler &profiler, Phase phase);   // Starts timing
+        ~PhaseScope();                                      // Adds the elapsed time to the profiler
+
+        PhaseScope(const PhaseScope&) = delete;
+        PhaseScope& operator=(const PhaseScope&) = delete;
+};
+
+#define PROFILE_JOIN_(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN_(a, b)
+
+#if defined(EVTOL_PROFILE)
+#define PROFILE_PHASE(profiler, phase) PhaseScope PROFILE_JOIN(profile_Scope, __LINE__)(profiler, phase)
+#define PROFILE_COUNT(profiler, counter, amount) (profiler).count(counter, amount)
+#define PROFILE_QUEUE(profiler, depth) (profiler).sample_Queue(depth)
+#else
+#define PROFILE_PHASE(profiler, phase) ((void)0)
+#define PROFILE_COUNT(profiler, counter, amount) ((void)0)
+#define PROFILE_QUEUE(profiler, depth) ((void)0)
+#endif
\ No newline at end of file
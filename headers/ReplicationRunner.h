@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <thread>
+#include <cmath>
+#include <cstdint>
+
+#include "Simulation.h"
+#include "Statistics.h"
+
+/**
+ * @brief Running estimate of one metric across independent replications.
+ *
+ * Samples are accumulated with Welford's method, so the estimate can be built in
+ * a single pass without storing the samples.
+ */
+struct Estimate{
+    int samples = 0;        // Number of replications contributing a sample
+    double mean = 0.0;      // Running mean of the samples
+    double m2 = 0.0;        // Running sum of squared deviations from the mean
+
+    /**
+     * @brief Adds one replication's value to the estimate.
+     * @param x Value observed in the replication.
+     */
+    void add(double x){
+        samples++;
+        double delta = x - mean;
+        mean += delta / samples;
+        m2 += delta * (x - mean);
+    }
+
+    /**
+     * @brief Computes the sample variance across replications.
+     * @return Unbiased variance, or 0 with fewer than two samples.
+     */
+    double variance() const{
+        return samples > 1 ? m2 / (samples - 1) : 0.0;
+    }
+
+    /**
+     * @brief Computes the half-width of the 95% confidence interval of the mean.
+     * @return 1.96 standard errors, using the normal approximation.
+     */
+    double ci95() const{
+        return samples > 1 ? 1.96 * std::sqrt(variance() / samples) : 0.0;
+    }
+};
+
+/**
+ * @brief Estimates of every reported metric for one vehicle type.
+ */
+struct ReplicationSummary{
+    std::string type_Name;          // Name of the vehicle type
+    Estimate avg_FlightTime;        // Average flight time per flight, over replications with at least one flight
+    Estimate avg_Distance;          // Average distance per flight, over replications with at least one flight
+    Estimate avg_ChargeTime;        // Average charge time per session, over replications with at least one charge
+    Estimate passenger_Miles;       // Total passenger miles per replication
+    Estimate faults;                // Total faults per replication
+    Distribution flight_Time;       // Flight times pooled over every replication
+    Distribution charge_Time;       // Charge times pooled over every replication
+    Distribution queue_Wait;        // Charger queue waits pooled over every replication
+};
+
+/**
+ * @brief Runs independent simulations in parallel and merges their statistics.
+ *
+ * Each replication builds its own Simulation on the worker that runs it, so its fleet,
+ * ChargerManager and Statistics are never shared with another thread. Replications do not
+ * write a fault log or print a summary; their Statistics are kept in replication order and
+ * merged into per-type means, variances and confidence intervals.
+ */
+class ReplicationRunner{
+    private:
+        int replications;                                       // Number of independent simulations to run
+        size_t thread_Count;                                    // Number of worker threads
+        bool event_Driven;                                      // Whether replications use the event-driven engine
+        uint64_t seed;                                          // Global seed, replication r uses (seed, r)
+        std::function<void(Simulation&, int)> setup;            // Prepares the simulation of each replication
+        std::vector<Statistics> results;                        // Statistics of each replication, in replication order
+
+    public:
+        ReplicationRunner(int replications, size_t threads = std::thread::hardware_concurrency(), bool event_Driven = false);     // Constructor function for class ReplicationRunner
+
+        void set_Seed(uint64_t seed);                               // Makes the whole set of replications reproducible
+        void set_Setup(std::function<void(Simulation&, int)> fn);  // Replaces the default per-replication setup (vehicle_Init)
+        void run();                                                 // Runs every replication and keeps their statistics
+        const std::vector<Statistics>& get_Results() const;        // Getter function to get the statistics of each replication
+        std::vector<ReplicationSummary> summarize() const;          // Merges the replications into per-type estimates
+        void print_Summary() const;                                 // Prints the per-type estimates
+};
\ No newline at end of file
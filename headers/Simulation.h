@@ -2,44 +2,123 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 
 #include "Vehicle.h"
-#include "Vehicle_Instance.h"
+#include "VehicleRegistry.h"
+#include "VehicleFleet.h"
 #include "Statistics.h"
-#include "ChargerManager.h"
+#include "ChargingNetwork.h"
+#include "EventQueue.h"
+#include "FaultLogSink.h"
+#include "EventTrace.h"
+#include "FleetManifest.h"
+#include "StatisticsShards.h"
+#include "ThreadPool.h"
+#include "PhaseProfiler.h"
+#include "SimulationArena.h"
 
 /**
  * @brief Class which facilitates simulation
  * 
  * The Simulation class manages vehicle initialization, simulates flight and charging behavior,
- * tracks time progression, and aggregates statistics. It also interacts with the ChargerManager
+ * tracks time progression, and aggregates statistics. It also interacts with the ChargingNetwork
  * to manage charging queues and vehicle states.
+ *
+ * The fleet arrays, charger slots and queues, pending events, per-vehicle tick flags and
+ * charge request buffers all allocate from the simulation's own SimulationArena, which is
+ * released in one go when the simulation is destroyed.
  */
 class Simulation{
     private:
-        std::vector<Vehicle> vehicle_Types;     // Definitions of different vehicle companies or types
-        std::vector<VehicleInstance> vehicles;  // All instances of vehicles present in the simulation
-        ChargerManager chargers;                // Manages charger availability and queueing
+        SimulationArena arena;                  // Memory of the per-vehicle state below, declared first so it outlives it
+        VehicleRegistry vehicle_Types;          // Definitions of different vehicle companies or types
+        VehicleFleet vehicles;                  // State of every vehicle present in the simulation
+        ChargingNetwork chargers;               // Manages charger availability and queueing at every site
         Statistics stats;                       // Tracks and aggregates simulation statistics
 
         double sim_time;                        // Simulation duration
         double current_time;                    // Keeps track of current time during the simulation
         double time_Increment;                  // Value by witch time increases in the simulation
 
+        std::string faultLog_Path;              // File receiving fault records, empty to disable fault logging
+        FaultLogSink fault_Log;                 // Writes fault records to file on a background thread
+        std::string trace_Path;                 // File receiving the binary event trace, empty to disable tracing
+        EventTrace trace;                       // Records flight, charger and fault events when tracing
+        std::pmr::vector<ChargeState> charger_State; // Per-vehicle charger state last written to the trace
+        std::pmr::vector<double> queued_Since;       // Time each queued vehicle joined the charger queue
+        bool print_Summary;                     // Whether a full run prints the statistics summary
+
+        std::pmr::vector<char> depleted;        // Per-vehicle flag: battery was empty at the start of the tick
+        std::pmr::vector<char> wasCharging;     // Per-vehicle flag: vehicle is waiting for or on a charger
+        std::pmr::vector<int> charge_Requests;  // Vehicles asking for a charger this tick, reused across ticks
+        bool run_Started = false;               // Whether chargers and the flags above carry over into the next fixed-step run
+
+        static constexpr size_t tick_Chunk = 4096;          // Vehicles per chunk of the tick; chunks, not threads, fix the merge order
+        size_t tick_Threads = 1;                            // Threads the per-chunk phases of a tick may use
+        std::unique_ptr<ThreadPool> tick_Pool;              // Workers for the parallel tick, created on first use
+        StatisticsShards tick_Stats;                        // Statistics logged by each chunk during a tick
+        std::pmr::vector<std::pmr::vector<int>> chunk_Requests;   // Charge requests of each chunk, in id order
+
+        PhaseProfiler profiler;                 // Phase timers and counters, filled only in an EVTOL_PROFILE build
+
+        EventQueue events;                      // Pending events for the event-driven engine
+        std::pmr::vector<double> last_Update;   // Time up to which each vehicle's state has been advanced
+
+        void apply_FaultDegradation(int id);                           // Reduces cruise speed after a fault
+        void open_FaultLog(const std::string &path);                   // Starts the fault log for a run, empty path leaves it closed
+        void log_Fault(int id, double time, Statistics &target);       // Counts a fault in the statistics, degrades and logs it
+        void open_Trace();                                             // Starts the event trace for a run if a trace path is set
+        void trace_ChargerState(int id, double time);                  // Traces a vehicle's charger queue transitions
+        void begin_TickRun();                                          // Clears the chargers and tick flags unless a run is being continued
+        void step_Tick();                                              // Advances every vehicle and the chargers by one time increment
+        void fly_Chunk(size_t chunk);                                  // Flight, fault and flight-end phase of a tick for one chunk
+        void settle_Chunk(size_t chunk);                               // Post-charge logging phase of a tick for one chunk
+        void for_EachChunk(void (Simulation::*phase)(size_t));         // Runs a chunk phase over the fleet, in parallel when enabled
+        void start_Flight(int index, double time);                     // Starts or resumes a flight and schedules its next event
+        void start_Charging(int index, double time);                   // Plugs a vehicle in and schedules charge completion
+        void handle_Event(const SimEvent &e);                          // Processes a single event
+        void print_Report();                                           // Prints the statistics and, when profiling, the phase profile
+        void save_State(CheckpointWriter &out) const;                  // Writes the clock, types, fleet, chargers, statistics and tick flags
+        bool load_State(CheckpointReader &in);                         // Replaces that state, leaving no vehicles if it is damaged
+
     public:
         Simulation();                           // Constructor function with default parameters
         void vehicle_Init();                    // Initializes vehicle definitions and creates corresponding instances
+        void vehicle_Init(const FleetManifest &manifest);  // Builds the vehicle types and fleet described by a manifest
         void run_Sim();                         // Runs the full simulation
+        void run_EventSim();                    // Runs the full simulation with the event-driven engine
+
+        void set_Seed(uint64_t seed, uint32_t replica = 0);    // Seeds fleet composition and fault draws
+        void set_FaultLogPath(const std::string &path);         // Sets the fault log file, empty disables it
+        void set_PrintSummary(bool enabled);                    // Enables or disables the summary printed after a full run
+        void set_TracePath(const std::string &path);            // Sets the binary event trace file, empty disables it
+        void set_TickThreads(size_t threads);                   // Sets how many threads the vehicle phases of a tick may use
+        void set_SimTime(double hours);                         // Sets the simulation duration
+        void set_TimeIncrement(double hours);                   // Sets the length of a tick of the fixed-step loop
+        bool save_Checkpoint(const std::string &path) const;    // Writes the complete simulation state to a binary file
+        bool load_Checkpoint(const std::string &path);          // Replaces the simulation state with a saved one
+        std::vector<char> snapshot() const;                     // Captures the complete simulation state in memory
+        bool restore(const std::vector<char> &image);           // Replaces the simulation state with a snapshot
+        void set_Branch(uint32_t branch);                       // Moves every vehicle's fault draws onto a branch's substream
+        std::unique_ptr<Simulation> fork(uint32_t branch) const;   // Independent copy of the current state on its own substream
+        std::vector<std::unique_ptr<Simulation>> fork(uint32_t first_Branch, size_t count) const;   // Several forks sharing one snapshot
         
         // Getter methods for testing
         double get_SimTime() const;                              // Getter function to get simulation time
         double get_CurrentTime() const;                          // Getter function to get current time in simulation
+        double get_TimeIncrement() const;                        // Getter function to get the length of a tick
         int get_VehicleCount() const;                            // Getter function to get vehicle count
-        VehicleInstance* get_VehiclePointer(int index);          // Getter function to get the vehicle pointer at index
-        ChargerManager& get_Chargers();                          // Getter functions to get the charger states
+        VehicleFleet& get_Fleet();                               // Getter function to get the state of every vehicle
+        ChargingNetwork& get_Chargers();                         // Getter functions to get and configure the charging sites
+        FaultLogSink& get_FaultLog();                            // Getter function to configure the fault log format and backpressure
+        PhaseProfiler& get_Profiler();                           // Getter function to get the phase timers and counters of the last run
         const Statistics& getStats() const { return stats; }    // Getter function to get stats of a particular vehicle
+        const SimulationArena& get_Arena() const;                // Getter function to get the memory held by the simulation
 
         void run_PartialSimulation(double duration);             // Runs simulation for a partial time
-        void request_ChargingForVehicle(VehicleInstance* v);     // Requests charging for a specific vehicle
+        void step(size_t ticks);                                 // Advances the fixed-step loop by whole ticks, with no file I/O
+        void advance_To(double time);                            // Advances the fixed-step loop to a time, with no file I/O
+        void request_ChargingForVehicle(int id);                 // Requests charging for a specific vehicle
         
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory_resource>
+#include <cstddef>
+
+/**
+ * @brief Memory owned by one simulation: a monotonic arena with size-class pools on top.
+ *
+ * Every per-vehicle array of the fleet, the charger slots and queues and the event queue
+ * of a Simulation allocate from resource(). Blocks are carved out of a few large chunks
+ * taken from the upstream resource, so a simulation's state sits together in memory and
+ * thousands of replicas do not interleave their allocations on the global heap. Small
+ * blocks, such as the buffers of a queue or of the pending events, are recycled through
+ * fixed-size pools when a container grows or is cleared; larger blocks are only given back
+ * when the arena is destroyed, which returns every chunk to the upstream resource at once.
+ *
+ * The arena is not thread-safe. The per-tick work on worker threads never allocates from
+ * it, because every container it backs is sized before the run starts.
+ */
+class SimulationArena{
+    private:
+        /**
+         * @brief Forwards to another resource and counts the chunks it hands out.
+         */
+        class CountingResource : public std::pmr::memory_resource{
+            private:
+                std::pmr::memory_resource *upstream;        // Resource the chunks come from
+                size_t blocks = 0;                          // Chunks currently held
+                size_t bytes = 0;                           // Bytes in the chunks currently held
+
+                void* do_allocate(size_t size, size_t alignment) override;
+                void do_deallocate(void *p, size_t size, size_t alignment) override;
+                bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+            public:
+                explicit CountingResource(std::pmr::memory_resource *upstream);
+
+                size_t get_Blocks() const;                  // Chunks currently held
+                size_t get_Bytes() const;                   // Bytes in the chunks currently held
+        };
+
+        static constexpr size_t default_Chunk = 64 * 1024;      // Size of the first chunk; later chunks grow geometrically
+
+        CountingResource chunks;                                // Upstream allocations made by the arena
+        std::pmr::monotonic_buffer_resource arena;              // Bump allocator carving blocks out of the chunks
+        std::pmr::unsynchronized_pool_resource pools;           // Size-class pools recycling small blocks within the arena
+
+    public:
+        explicit SimulationArena(size_t initial_Chunk = default_Chunk,
+                                 std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());   // Creates an empty arena
+
+        SimulationArena(const SimulationArena&) = delete;
+        SimulationArena& operator=(const SimulationArena&) = delete;
+
+        std::pmr::memory_resource* resource();                  // Resource the simulation's containers allocate from
+        size_t chunk_Count() const;                             // Chunks taken from the upstream resource so far
+        size_t reserved_Bytes() const;                          // Bytes in those chunks
+};
\ No newline at end of file
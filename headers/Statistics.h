@@ -1,16 +1,26 @@
 #pragma once
 
-#include <map>
+#include <vector>
 #include <string>
 
+#include "Vehicle.h"
+#include "Distribution.h"
+#include "Checkpoint.h"
+
 /**
  * @brief Aggregates statistics for a single vehicle type.
  * 
  * This struct accumulates total values like flight time, distance, charge time,
  * faults, and passenger miles. It also provides utility functions to compute
- * averages based on flight and charge counts.
+ * averages based on flight and charge counts. Flight times, charge times and charger
+ * queue waits are also kept as Distributions, which give their variance and tail
+ * percentiles in bounded memory and merge across threads and replicas.
+ *
+ * Each entry is aligned and padded to whole cache lines, so a StatList buffer starts and
+ * ends on a line boundary and the entries that shards log into in parallel never share a
+ * line with another shard's.
  */
-struct Stats{
+struct alignas(64) Stats{
     double total_FlightTime = 0.0;      // Cumulative flight time
     double total_Distance = 0.0;        // Cumulative distance flown
     double total_ChargingTime = 0.0;    // Cumulative charging time
@@ -19,6 +29,10 @@ struct Stats{
     int flight_count = 0;               // Number of flights logged
     int charge_count = 0;               // Number of charges logged
 
+    Distribution flight_Time;           // Distribution of logged flight times
+    Distribution charge_Time;           // Distribution of logged charge times
+    Distribution queue_Wait;            // Distribution of time spent queued before getting a charger
+
     /**
      * @brief Computes the average flight time per flight.
      * @return Average flight time, or 0 if no flights were logged.
@@ -47,17 +61,27 @@ struct Stats{
 /**
  * @brief Tracks and logs operational statistics for all vehicle types.
  * 
- * This class maintains a mapping from vehicle type names to their
- * corresponding Stats structures. It supports logging of flight sessions,
- * charge events, and faults, and provides a summary printout for analysis.
+ * This class keeps one Stats structure per registered vehicle type in a flat
+ * array indexed by TypeId, so logging never touches the type name. It supports
+ * logging of flight sessions, charge events, and faults, and provides a summary
+ * printout for analysis.
  */
 class Statistics{
     public:
-        std::map<std::string, Stats> StatMap;                                                                   // Map from vehicle type to its corresponding statistics
+        std::vector<Stats> StatList;                                                                            // Statistics of each vehicle type, indexed by TypeId
+        std::vector<std::string> type_Names;                                                                    // Name of each vehicle type, indexed by TypeId
+
+        void register_Type(TypeId vehicle_type, const std::string &name);                                       // Adds a vehicle type under the id given by the VehicleRegistry
+        TypeId find_Type(const std::string &name) const;                                                        // Looks up a registered type by name, -1 if unknown
 
-        void log_Flight(const std::string &vehicle_type, double flight_time, double distance, int passengers);  // Logs flight data for a specific vehicle type.
-        void log_Charge(const std::string &vehicle_type, double charge_time);                                   // Logs a charging event for a specific vehicle type.
-        void log_Faults(const std::string &vehicle_type);                                                       // Logs a fault occurrence for a specific vehicle type.
+        void log_Flight(TypeId vehicle_type, double flight_time, double distance, int passengers);              // Logs flight data for a specific vehicle type.
+        void log_Charge(TypeId vehicle_type, double charge_time);                                               // Logs a charging event for a specific vehicle type.
+        void log_Faults(TypeId vehicle_type);                                                                   // Logs a fault occurrence for a specific vehicle type.
+        void log_Wait(TypeId vehicle_type, double wait_time);                                                   // Logs the time a vehicle queued before getting a charger.
+        void merge(const Statistics &other);                                                                    // Adds another Statistics' totals, type by type
+        void clear();                                                                                           // Zeroes every total, keeping the registered types
+        void save(CheckpointWriter &out) const;                                                                 // Writes the types and every total to a checkpoint
+        bool load(CheckpointReader &in);                                                                        // Replaces the types and totals with those read from a checkpoint
         
         int get_ChargerCount(const std::string& type) const;                                                      // Getter function to get charger count for specific vehicle
         int get_fault_Count(const std::string& type) const;                                                       // Getter function to get fault count
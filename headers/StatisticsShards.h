@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include "Statistics.h"
+
+/**
+ * @brief A set of Statistics that parallel workers log into without synchronization.
+ *
+ * Each shard belongs to one unit of work (a charging site, a block of vehicles), is written
+ * by one thread at a time and sits on its own cache lines, so shards written side by side
+ * never share a line. That covers both the Statistics object and the StatList buffer every
+ * log call writes, since Stats entries are cache-line aligned and padded themselves.
+ *
+ * merge_Into folds the shards into a target Statistics in shard order and clears them, so
+ * the result depends only on how the work was split into shards, not on which threads ran
+ * them. Cleared shards keep their memory, so logging and merging tick after tick does not
+ * allocate.
+ */
+class StatisticsShards{
+    private:
+        /**
+         * @brief One Statistics padded to whole cache lines.
+         */
+        struct alignas(64) Shard{
+            Statistics stats;       // Totals logged by the shard's owner since the last merge
+        };
+
+        std::vector<Shard> shards;                  // Every shard, in merge order
+
+    public:
+        void resize(size_t count);                          // Sets the number of shards, keeping existing ones
+        size_t size() const;                                // Number of shards
+        void prepare(const Statistics &layout);             // Gives every shard the types of layout
+        Statistics& operator[](size_t index);               // Shard for one unit of work
+        void merge_Into(Statistics &target);                // Adds every shard to target in order and clears them
+};
\ No newline at end of file
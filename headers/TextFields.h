@@ -0,0 +1,42 @@
+#pragma once
+
+#include <charconv>
+#include <string_view>
+#include <system_error>
+
+/**
+ * @brief Field helpers shared by the text readers of fleet manifests and sweep specs.
+ */
+class TextFields{
+    public:
+        /**
+         * @brief Checks for the whitespace allowed around fields and JSON tokens.
+         */
+        static bool is_Space(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        /**
+         * @brief Strips surrounding whitespace.
+         */
+        static std::string_view trim(std::string_view s)
+        {
+            while (!s.empty() && is_Space(s.front()))
+                s.remove_prefix(1);
+            while (!s.empty() && is_Space(s.back()))
+                s.remove_suffix(1);
+            return s;
+        }
+
+        /**
+         * @brief Reads a whole field as a number.
+         *
+         * @return true if the field is exactly one number; false otherwise.
+         */
+        static bool to_Number(std::string_view s, double &out)
+        {
+            std::from_chars_result r = std::from_chars(s.data(), s.data() + s.size(), out);
+            return r.ec == std::errc() && r.ptr == s.data() + s.size();
+        }
+};
\ No newline at end of file
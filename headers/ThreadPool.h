@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+/**
+ * @brief Fixed-size pool of worker threads with per-worker task queues and work stealing.
+ *
+ * Every worker owns a deque. Tasks submitted from a worker go to the back of its own deque,
+ * tasks submitted from outside are spread round-robin. A worker takes from the back of its
+ * own deque first and, once that is empty, steals from the front of the others, so long
+ * tasks on one worker do not leave the rest idle.
+ */
+class ThreadPool{
+    private:
+        struct WorkerQueue{
+            std::deque<std::function<void()>> tasks;    // Tasks waiting on this worker
+            std::mutex lock;                            // Guards tasks
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;   // One queue per worker
+        std::vector<std::thread> workers;                   // Worker threads
+
+        std::mutex state_Lock;                              // Guards the counters and flags below
+        std::condition_variable work_Available;             // Signalled when a task is queued or the pool stops
+        std::condition_variable all_Done;                   // Signalled when the last pending task finishes
+        size_t queued = 0;                                  // Tasks sitting in a queue
+        size_t pending = 0;                                 // Tasks submitted and not yet finished
+        bool stopping = false;                              // Set when the pool is being destroyed
+        std::atomic<size_t> next_Queue{0};                  // Round-robin cursor for outside submissions
+
+        bool try_Pop(size_t self, std::function<void()> &task);    // Takes a task from the own queue or steals one
+        void worker_Loop(size_t self);                              // Body of each worker thread
+
+    public:
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());     // Starts the worker threads
+        ~ThreadPool();                                                                  // Finishes queued tasks and joins the workers
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> task);    // Queues a task
+        void wait_Idle();                           // Blocks until every submitted task has finished
+        size_t size() const;                        // Number of worker threads
+};
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "EventTrace.h"
+#include "MappedFile.h"
+
+/**
+ * @brief Columns of one trace block, pointing straight into the mapped file.
+ */
+struct TraceBlock{
+    size_t count;               // Events in this block
+    const double *time;         // Simulation time of each event
+    const double *value;        // Kind-specific value of each event
+    const int32_t *vehicle;     // Fleet id of each event
+    const int16_t *type;        // TypeId of each event
+    const uint8_t *kind;        // TraceKind of each event
+};
+
+/**
+ * @brief Read-only view of a trace file written by EventTrace.
+ *
+ * The file is memory-mapped, so opening it costs nothing beyond checking the header and
+ * queries touch only the blocks and columns they read. A time window is located by binary
+ * search over the blocks. On platforms without mmap the file is read into memory instead.
+ */
+class TraceReader{
+    private:
+        MappedFile file;                        // The trace file, mapped read-only
+        const unsigned char *data = nullptr;    // Start of the mapped file
+        size_t length = 0;                      // Size of the mapped file in bytes
+
+        TraceHeader header{};                   // Copy of the file header
+        TraceLayout layout{};                   // Column offsets of a block
+        std::vector<std::string> type_Names;    // Name of each type, indexed by TypeId
+        size_t blocks = 0;                      // Number of blocks in the file
+        uint64_t events = 0;                    // Number of events in the file
+
+    public:
+        TraceReader() = default;
+        ~TraceReader();                         // Unmaps the file
+
+        TraceReader(const TraceReader&) = delete;
+        TraceReader& operator=(const TraceReader&) = delete;
+
+        bool open(const std::string &path);     // Maps a trace file and checks its header
+        void close();                           // Unmaps the file
+
+        size_t block_Count() const;             // Number of blocks
+        uint64_t event_Count() const;           // Number of events
+        TraceBlock block(size_t index) const;   // Columns of one block
+        size_t find_Block(double time) const;   // First block that may hold events at or after a time
+
+        size_t type_Count() const;                          // Number of vehicle types
+        const std::string& type_Name(TypeId type) const;    // Name of a vehicle type
+};
\ No newline at end of file
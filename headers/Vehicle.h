@@ -2,6 +2,8 @@
 
 #include <string>
 
+using TypeId = int;     // Dense id of a registered vehicle type, see VehicleRegistry
+
 /**
  * @brief Defines the static configuration of a vehicle type.
  * 
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+
+#include "Vehicle.h"
+#include "Checkpoint.h"
+
+/**
+ * @brief Where a vehicle stands with respect to the chargers.
+ */
+enum class ChargeState : uint8_t{
+    Idle,           // Flying or grounded, not waiting for a charger
+    Queued,         // Waiting in the charger queue
+    Charging        // Plugged into a charger
+};
+
+/**
+ * @brief Stores the runtime state of every vehicle in the simulation as parallel arrays.
+ *
+ * Each field lives in its own contiguous array indexed by vehicle id, so the per-tick
+ * kernels stream through the hot fields (battery, cruise speed, session values) without
+ * touching the cold ones (type id, random stream position). The range functions advance a
+ * contiguous block of vehicles; the single-id functions are used by event handling and
+ * the charger manager. Vehicles refer to their shared type definition by TypeId and only
+ * keep copies of the parameters the kernels read. Builds with -DEVTOL_CERTIFIED_TYPES fly and
+ * charge runs of vehicles whose type matches an entry of certified_Types with kernels that
+ * have the type's parameters compiled in; the parameter arrays of those vehicles must then
+ * not be edited after the fleet is built.
+ *
+ * While a vehicle is on a charger its battery and charging time are only brought up to date
+ * when the charger manager queries or releases it (charge_Until); charged_Until records
+ * the charger clock time they are current to.
+ *
+ * The arrays allocate from the memory resource given at construction, so a Simulation keeps
+ * its fleet in its own SimulationArena. A copy of a fleet allocates from the default resource.
+ */
+class VehicleFleet{
+    public:
+        static constexpr double charge_Tolerance = 1e-6;     // kWh short of capacity at which a battery counts as full
+
+        // Hot state, touched every tick
+        std::pmr::vector<double> current_Battery;        // Current battery level(kWh)
+        std::pmr::vector<double> actualCruiseSpeed;      // Updated cruise speed if fault occurs
+        std::pmr::vector<double> session_FlightTime;     // Flight time for the current flight session
+        std::pmr::vector<double> session_Distance;       // Distance flown in the current flight session
+        std::pmr::vector<int> session_PassengerMiles;    // Passenger Miles for the current flight session
+        std::pmr::vector<double> next_FaultHours;        // Accumulated flight hours at which the vehicle's next fault occurs
+
+        // Per-vehicle copies of the type parameters used by the kernels
+        std::pmr::vector<double> energy_PerMile;         // Energy consumption per mile in kWh
+        std::pmr::vector<double> battery_Capacity;       // Battery capacity in kWh
+        std::pmr::vector<double> charge_Rate;            // kWh added per hour of charging
+        std::pmr::vector<int> passenger_Count;           // Number of passengers carried per trip
+        std::pmr::vector<double> cruiseSpeed;            // Rated cruise speed, the floor for fault degradation is half of it
+        std::pmr::vector<double> fault_Probability;      // Probability of a fault per flight hour
+
+        // Running totals
+        std::pmr::vector<double> total_flightTime;       // Total time spent flying(hours)
+        std::pmr::vector<double> total_chargingTime;     // Time spent charging in the current session(hours)
+        std::pmr::vector<int> fault_Count;               // Total faults encountered
+        std::pmr::vector<double> distanceFlown;          // Total distance flown(miles)
+        std::pmr::vector<int> passengerMiles;            // Total calculated Passenger Miles
+
+        // Cold state
+        std::pmr::vector<TypeId> type_Id;                // Registered type of each vehicle, see VehicleRegistry
+        std::pmr::vector<uint32_t> rng_Counter;          // Number of random draws each vehicle has made so far
+        std::pmr::vector<int> certified_Type;            // Per TypeId, not per vehicle: index of the matching certified type, -1 if none
+
+        // Charger state, owned by ChargerManager
+        std::pmr::vector<ChargeState> charge_State;      // Whether each vehicle is idle, queued or on a charger
+        std::pmr::vector<int> charger_Slot;              // Index of the vehicle in its manager's charger slots, -1 if not charging
+        std::pmr::vector<double> queued_Since;           // Charger clock time at which a queued vehicle joined the queue
+        std::pmr::vector<double> charged_Until;          // Charger clock time up to which a charging vehicle's battery is current
+
+        uint64_t seed;                                   // Global seed shared by every vehicle's random stream
+        uint32_t replica;                                // Replication id, keeps replicas with the same seed independent
+        uint32_t branch;                                 // Forked branch id, keeps branches of one warm state independent
+
+        explicit VehicleFleet(std::pmr::memory_resource *resource = std::pmr::get_default_resource());   // Creates an empty fleet with a fresh random seed
+        std::pmr::memory_resource* resource() const;                          // Resource every array allocates from
+
+        void set_Seed(uint64_t seed, uint32_t replica = 0);                   // Makes every random draw reproducible
+        void set_Branch(uint32_t branch);                                     // Moves every vehicle onto a branch's random substream
+        double draw_Uniform(int id);                                          // Next uniform number in [0, 1) from a vehicle's stream
+
+        int add(TypeId type, const Vehicle &vehicleType);                     // Appends a fully charged vehicle and returns its id
+        int add(TypeId type, const Vehicle &vehicleType, size_t count);       // Appends count identical vehicles and returns the first id
+        size_t size() const;                                                  // Number of vehicles in the fleet
+        void resize(size_t count);                                            // Grows or shrinks every array to count vehicles
+        void assign(size_t begin, size_t end, TypeId type, const Vehicle &vehicleType);   // Resets [begin, end) to fresh vehicles of one type
+        void clear();                                                         // Removes every vehicle
+        void match_Certified(TypeId type, size_t id);                         // Records whether a type's parameters match a certified type
+        void save(CheckpointWriter &out) const;                               // Writes every array and the random stream seeds to a checkpoint
+        bool load(CheckpointReader &in, size_t type_Count);                   // Replaces the fleet with one read from a checkpoint
+
+        void fly(size_t begin, size_t end, double time_increment);            // Flies every non-depleted vehicle in [begin, end)
+        void fly_Idle(size_t begin, size_t end, double time_increment);       // Flies the vehicles in [begin, end) that are not queued or charging
+        void charge(size_t begin, size_t end, double time_increment);         // Charges every vehicle in [begin, end)
+        void charge(const std::pmr::vector<int> &ids, double time_increment); // Charges the listed vehicles, e.g. a manager's charger slots
+        void charge_depleted(size_t begin, size_t end, std::pmr::vector<char> &depleted) const;   // Writes a depletion flag for every vehicle in [begin, end)
+
+        void fly(int id, double time_increment);           // Simulates flight and updates session parameters
+        void charge(int id, double time_increment);        // Simulates battery charging
+        bool simulate_Fault(int id);                       // Counts a fault if the vehicle has flown past its next fault time
+        void record_Fault(int id);                         // Counts a fault and draws the flight hours of the next one
+        bool charge_depleted(int id) const;                // Checks if the battery is depleted
+        bool charge_completed(int id) const;               // Checks if the battery is fully charged
+        void finalize_FlightSession(int id);               // Updates total parameters with the current session parameters
+        double time_ToDepletion(int id) const;             // Hours of flight left at the current cruise speed
+        double time_ToFullCharge(int id) const;            // Hours of charging needed to reach full capacity
+        void charge_Until(int id, double time);            // Applies the charging a vehicle on a charger has done since its last update
+        double charge_CompleteAt(int id) const;            // Charger clock time at which a charging vehicle counts as full
+        double flight_Hours(int id) const;                 // Flight hours accumulated over every session so far
+        double time_ToNextFault(int id) const;             // Hours of flight left before the next fault
+        double next_FaultInterval(int id);                 // Draws the flight time until the next fault
+};
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "Vehicle.h"
+#include "Checkpoint.h"
+
+/**
+ * @brief Holds the single shared definition of every vehicle type in the simulation.
+ *
+ * Each type is registered once and given a dense TypeId, which vehicles and
+ * statistics use in place of the type name. Names are only looked up when
+ * registering or reporting.
+ */
+class VehicleRegistry{
+    private:
+        std::vector<Vehicle> types;                         // Vehicle definitions indexed by TypeId
+        std::unordered_map<std::string, TypeId> ids;        // Type name to TypeId, used only at registration
+
+    public:
+        TypeId register_Type(const Vehicle &vehicleType);   // Adds a type, or returns the id of an already registered one
+        TypeId find(const std::string &name) const;         // Looks up a type by name, -1 if unknown
+        const Vehicle& get(TypeId id) const;                // Returns the definition of a type
+        size_t size() const;                                // Number of registered types
+        void save(CheckpointWriter &out) const;             // Writes every type definition to a checkpoint
+        bool load(CheckpointReader &in);                    // Replaces the types with those read from a checkpoint
+};
\ No newline at end of file
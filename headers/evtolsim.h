@@ -0,0 +1,165 @@
+#pragma once
+
+/*
+ * C API of libevtolsim, for driving the simulator from other languages and tools.
+ *
+ * A simulation is created once from a configuration and then advanced a few ticks at a
+ * time with evtol_step or evtol_advance_to. Stepping does no file I/O and never resets
+ * the chargers, so any sequence of steps ends like one run of the same length. The fleet
+ * and statistics views point straight into the simulation's own arrays: nothing is
+ * copied, and the pointers stay valid until the simulation is destroyed. The values they
+ * point at change with every step. None of the functions may be called on one simulation
+ * from two threads at once; separate simulations are independent. No C++ exception ever
+ * leaves the API: a call that fails reports it through its return value and
+ * evtol_last_error.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque handle to one simulation.
+ */
+typedef struct evtol_sim evtol_sim;
+
+/**
+ * @brief Settings a simulation is created from. Fill with evtol_config_init first.
+ */
+typedef struct evtol_config {
+    const char *manifest_path;      /* CSV or JSON fleet manifest, NULL for the built-in 20 vehicles */
+    const char *checkpoint_path;    /* Checkpoint to resume from instead of building a fleet, NULL for none */
+    uint64_t seed;                  /* Global seed; the same seed gives the same run */
+    uint32_t replica;               /* Replication id, keeps runs with the same seed independent */
+    double time_increment;          /* Hours per tick, taken from the checkpoint when resuming */
+    int sites;                      /* Charging sites */
+    int chargers_per_site;          /* Chargers at every site */
+    int tick_threads;               /* Threads flying the fleet in each tick */
+    int site_threads;               /* Threads updating the charging sites in each tick */
+} evtol_config;
+
+/**
+ * @brief Read-only view of every vehicle's state, one array element per vehicle id.
+ */
+typedef struct evtol_fleet_view {
+    size_t count;                           /* Number of vehicles */
+    const double *battery;                  /* Current battery level (kWh) */
+    const double *battery_capacity;         /* Battery capacity (kWh) */
+    const double *cruise_speed;             /* Current cruise speed, lowered by faults (mph) */
+    const double *session_flight_time;      /* Flight time of the current flight (hours) */
+    const double *total_flight_time;        /* Flight time of the finished flights (hours) */
+    const double *distance_flown;           /* Distance of the finished flights (miles) */
+    const int *fault_count;                 /* Faults so far */
+    const int *passenger_miles;             /* Passenger miles of the finished flights */
+    const int *type_id;                     /* Vehicle type, an index into the statistics view */
+    const uint8_t *charge_state;            /* 0 idle or flying, 1 queued for a charger, 2 charging */
+} evtol_fleet_view;
+
+/**
+ * @brief Read-only view of the statistics of every vehicle type.
+ *
+ * The values of one type are stride bytes apart in every array: type i's flight count is
+ * *(const int *)((const char *)view.flight_count + i * view.stride), see evtol_stat_double
+ * and evtol_stat_int.
+ */
+typedef struct evtol_stats_view {
+    size_t count;                           /* Number of vehicle types */
+    size_t stride;                          /* Bytes from one type to the next in every array */
+    const double *total_flight_time;        /* Hours flown */
+    const double *total_distance;           /* Miles flown */
+    const double *total_charging_time;      /* Hours spent charging */
+    const int *total_faults;                /* Faults */
+    const int *total_passenger_miles;       /* Passenger miles */
+    const int *flight_count;                /* Flights logged */
+    const int *charge_count;                /* Charges logged */
+} evtol_stats_view;
+
+/**
+ * @brief Fills a configuration with the defaults of the command line simulator.
+ *
+ * No manifest or checkpoint, seed 0, replica 0, half-hour ticks, one site of 3 chargers, one thread.
+ */
+void evtol_config_init(evtol_config *config);
+
+/**
+ * @brief Creates a simulation at time 0, or at the time of the resumed checkpoint.
+ *
+ * Reads the manifest or checkpoint once; nothing is read or written afterwards.
+ *
+ * @return The new simulation, or NULL if the configuration or a file is invalid (see evtol_last_error).
+ */
+evtol_sim* evtol_create(const evtol_config *config);
+
+/**
+ * @brief Destroys a simulation and frees all of its memory. Views taken from it become invalid.
+ */
+void evtol_destroy(evtol_sim *sim);
+
+/**
+ * @brief Advances a simulation by whole ticks.
+ *
+ * @return The simulation time after the step in hours, or -1 if stepping failed (see
+ *         evtol_last_error); the simulation may then be part way through a tick and should be destroyed.
+ */
+double evtol_step(evtol_sim *sim, uint64_t ticks);
+
+/**
+ * @brief Advances a simulation to the first tick boundary at or after a time.
+ *
+ * @return The simulation time after the step in hours, or -1 on failure as for evtol_step.
+ */
+double evtol_advance_to(evtol_sim *sim, double time);
+
+/**
+ * @brief Returns the current simulation time in hours.
+ */
+double evtol_time(const evtol_sim *sim);
+
+/**
+ * @brief Fills a view of the fleet.
+ *
+ * Chargers update batteries lazily, so this also brings the battery of every vehicle on a
+ * charger up to the current time. Take the view again after stepping to see current
+ * batteries of charging vehicles; the pointers themselves do not change.
+ *
+ * @return 1 if the view was filled, 0 on failure with the reason in evtol_last_error.
+ */
+int evtol_fleet(evtol_sim *sim, evtol_fleet_view *view);
+
+/**
+ * @brief Fills a view of the per-type statistics.
+ */
+void evtol_stats(const evtol_sim *sim, evtol_stats_view *view);
+
+/**
+ * @brief Returns the name of a vehicle type, or NULL for an unknown type. Valid until the simulation is destroyed.
+ */
+const char* evtol_type_name(const evtol_sim *sim, int type);
+
+/**
+ * @brief Returns why the last call on this thread that can fail did so, or an empty string if it succeeded.
+ */
+const char* evtol_last_error(void);
+
+/**
+ * @brief Reads a double of one type from a strided statistics array.
+ */
+static inline double evtol_stat_double(const double *values, size_t stride, size_t type)
+{
+    return *(const double *)((const char *)values + type * stride);
+}
+
+/**
+ * @brief Reads an int of one type from a strided statistics array.
+ */
+static inline int evtol_stat_int(const int *values, size_t stride, size_t type)
+{
+    return *(const int *)((const char *)values + type * stride);
+}
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
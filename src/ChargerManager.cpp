@@ -1,97 +1,426 @@
 #include "ChargerManager.h"
 
-#include <iomanip>
-#include <iostream>
-
 using namespace std;
 
 /**
  * @brief Constructs a ChargerManager with maximum chargers available and a reference to the stats logger.
  * 
+ * The charger slots are reserved here, so plugging vehicles in never allocates.
+ * 
  * @param statsRef Reference to the Statistics object for logging charging sessions.
+ * @param fleetRef Reference to the fleet whose vehicles are charged.
  * @param chargers_Available Number of available charging stations (default maximum = 3).
  */
-ChargerManager::ChargerManager(Statistics& statsRef, int chargers_Available)
-    : stats(statsRef), maxChargers(chargers_Available) {}
+template <class Queue>
+BasicChargerManager<Queue>::BasicChargerManager(Statistics& statsRef, VehicleFleet& fleetRef, int chargers_Available)
+    : maxChargers(chargers_Available), charging_Vehicles(fleetRef.resource()), finishing(fleetRef.resource()),
+      waiting(fleetRef.resource()), stats(&statsRef), fleet(fleetRef)
+{
+    charging_Vehicles.reserve(maxChargers > 0 ? maxChargers : 0);
+}
 
 /**
  * @brief Checks if a charger is available.
  * 
  * @return true if available, false otherwise.
  */
-bool ChargerManager::charger_Availability() const
+template <class Queue>
+bool BasicChargerManager<Queue>::charger_Availability() const
 {
     return charging_Vehicles.size() < maxChargers;
 }
 
+/**
+ * @brief Puts a vehicle on the next free charger slot and logs how long it waited.
+ * 
+ * The vehicle is keyed in the heap by the current time, so the next update gives it its first charge.
+ * 
+ * @param id Fleet id of the vehicle, idle or just taken off the queue; a charger must be available.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::plug_In(int id)
+{
+    double wait = fleet.charge_State[id] == ChargeState::Queued ? clock - fleet.queued_Since[id] : 0.0;
+    stats->log_Wait(fleet.type_Id[id], wait);
+
+    fleet.charger_Slot[id] = static_cast<int>(charging_Vehicles.size());
+    fleet.charge_State[id] = ChargeState::Charging;
+    charging_Vehicles.push_back(id);
+
+    fleet.charged_Until[id] = clock;
+    finishing.push(id, clock);
+}
+
+/**
+ * @brief Takes a vehicle off its charger slot, with its battery brought up to the current time.
+ * 
+ * The last occupied slot moves into the freed one, so removal is O(1) apart from leaving the heap.
+ * 
+ * @param id Fleet id of a vehicle that is charging.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::unplug(int id)
+{
+    fleet.charge_Until(id, clock);
+    finishing.remove(id);
+
+    int slot = fleet.charger_Slot[id];
+    int last = charging_Vehicles.back();
+
+    charging_Vehicles[slot] = last;
+    fleet.charger_Slot[last] = slot;
+    charging_Vehicles.pop_back();
+
+    fleet.charger_Slot[id] = -1;
+    fleet.charge_State[id] = ChargeState::Idle;
+}
+
 /**
  * @brief Handles a vehicle’s request to charge.
  * 
  * If a charger is available, the vehicle is added to the active chargers list;
  * otherwise, it is queued.
  * 
- * @param v Pointer to the VehicleInstance requesting a charge.
+ * @param id Fleet id of the vehicle requesting a charge.
  */
-void ChargerManager::charge_Request(VehicleInstance *v)
+template <class Queue>
+void BasicChargerManager<Queue>::charge_Request(int id)
 {
     // Prevent duplicates
-    if (known_Vehicles.count(v) > 0)
+    if (id < 0 || static_cast<size_t>(id) >= fleet.size() || fleet.charge_State[id] != ChargeState::Idle)
         return;
 
-    known_Vehicles.insert(v);
-
     if(charger_Availability())
     {
-        charging_Vehicles.push_back(v);
+        finishing.reserve(fleet.size(), maxChargers);
+        plug_In(id);
     }
     else{
-        waiting_Queue.push(v);
+        waiting.reserve(fleet.size());
+        finishing.reserve(fleet.size(), maxChargers);
+        waiting.push(fleet, id);
+        fleet.charge_State[id] = ChargeState::Queued;
+        fleet.queued_Since[id] = clock;
     }
 }
 
 /**
- * @brief Updates the state of all charging vehicles for a given time step and progresses charging.
+ * @brief Handles charge requests from several vehicles at once.
  * 
- * Vehicles that finish charging are removed and logged and vehicles from the queue
- * are promoted if slots become available.
+ * Equivalent to requesting for each id in order, but the waiting queue is sized once for
+ * the whole batch.
+ * 
+ * @param ids Fleet ids of the vehicles requesting a charge, in request order; any
+ *            contiguous buffer, e.g. the data() of a std::vector or std::pmr::vector.
+ * @param count Number of ids.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::charge_Request(const int *ids, size_t count)
+{
+    waiting.reserve(fleet.size());
+    finishing.reserve(fleet.size(), maxChargers);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        charge_Request(ids[i]);
+    }
+}
+
+/**
+ * @brief Progresses charging by a time step, touching only the vehicles that plugged in or finish.
+ * 
+ * The clock moves to the end of the step first. Every vehicle whose heap key has passed is
+ * charged up to the clock: one that plugged in since the last update is re-keyed by the
+ * time it will be full, unless it is full already; one that is full is removed and logged.
+ * Vehicles from the queue are then promoted if slots became available, and have waited
+ * until the end of the step. Vehicles still charging keep the battery level of their last
+ * update until they finish or are synced.
  * 
  * @param time_increment Time in hours to simulate charging progression.
  */
-void ChargerManager::charge_Update(double time_increment)
+template <class Queue>
+void BasicChargerManager<Queue>::charge_Update(double time_increment)
 {
-    vector<VehicleInstance*> stillCharging;
+    clock += time_increment;
 
-    for(VehicleInstance *v: charging_Vehicles)
+    while (!finishing.empty() && finishing.top_Key() <= clock)
     {
-        v->charge(time_increment);
+        int id = finishing.pop();
+        fleet.charge_Until(id, clock);
 
-        if(!v->charge_completed())
+        double full = fleet.charge_CompleteAt(id);
+        if (full > clock && !fleet.charge_completed(id))
         {
-            stillCharging.push_back(v);
-        }
-        else{
-            stats.log_Charge(v->vehicle_type.name, time_increment);
-            known_Vehicles.erase(v);                                   // If finished charging then remove from tracking set
+            finishing.push(id, full);                       // First charge since plugging in, next touch when it is full
+            continue;
         }
+
+        fleet.current_Battery[id] = fleet.battery_Capacity[id];
+        stats->log_Charge(fleet.type_Id[id], time_increment);
+        unplug(id);
+    }
+
+    while(waiting.size() > 0 && charger_Availability())
+    {
+        plug_In(waiting.pop());
+    }
+}
+
+/**
+ * @brief Checks if a vehicle is currently occupying a charger.
+ * 
+ * @param id Fleet id of the vehicle to look up.
+ * @return true if the vehicle is charging, false if it is queued or unknown.
+ */
+template <class Queue>
+bool BasicChargerManager<Queue>::is_Charging(int id) const
+{
+    return id >= 0 && static_cast<size_t>(id) < fleet.size() && fleet.charge_State[id] == ChargeState::Charging;
+}
+
+/**
+ * @brief Checks if a vehicle is waiting in the queue for a charger.
+ * 
+ * @param id Fleet id of the vehicle to look up.
+ * @return true if the vehicle is queued, false if it is charging or unknown.
+ */
+template <class Queue>
+bool BasicChargerManager<Queue>::is_Waiting(int id) const
+{
+    return id >= 0 && static_cast<size_t>(id) < fleet.size() && fleet.charge_State[id] == ChargeState::Queued;
+}
+
+/**
+ * @brief Returns the number of vehicles waiting for a charger.
+ * 
+ * @return size_t Length of the waiting queue.
+ */
+template <class Queue>
+size_t BasicChargerManager<Queue>::queue_Length() const
+{
+    return waiting.size();
+}
+
+/**
+ * @brief Returns the number of vehicles on a charger.
+ * 
+ * @return size_t Occupied charger slots.
+ */
+template <class Queue>
+size_t BasicChargerManager<Queue>::charging_Count() const
+{
+    return charging_Vehicles.size();
+}
+
+/**
+ * @brief Returns a queued vehicle, e.g. to visit every vehicle in the queue.
+ * 
+ * Indices follow the queue's storage, which is admission order only for FifoQueue.
+ * 
+ * @param index Index in the queue, below queue_Length().
+ * @return int Fleet id of the vehicle.
+ */
+template <class Queue>
+int BasicChargerManager<Queue>::queued_At(size_t index) const
+{
+    return waiting.at(index);
+}
+
+/**
+ * @brief Checks that a vehicle occupies this manager's charger slot recorded on the fleet.
+ * 
+ * @param id Fleet id of the vehicle to look up.
+ * @return true if the slot in charger_Slot holds the vehicle; false otherwise.
+ */
+template <class Queue>
+bool BasicChargerManager<Queue>::holds(int id) const
+{
+    if (id < 0 || static_cast<size_t>(id) >= fleet.size())
+        return false;
+
+    int slot = fleet.charger_Slot[id];
+    return slot >= 0 && static_cast<size_t>(slot) < charging_Vehicles.size() && charging_Vehicles[slot] == id;
+}
+
+/**
+ * @brief Releases the charger held by a vehicle that has finished charging.
+ * 
+ * Used by the event-driven engine, which computes charge completion itself instead of
+ * stepping charge_Update. The vehicle's battery is brought up to the current time first.
+ * The front of the waiting queue takes over the freed charger.
+ * 
+ * @param id Fleet id of the vehicle leaving its charger.
+ * @return int Id of the vehicle promoted from the queue, or -1 if none was waiting.
+ */
+template <class Queue>
+int BasicChargerManager<Queue>::charge_Release(int id)
+{
+    if (!is_Charging(id))
+        return -1;
+
+    unplug(id);
+
+    if (waiting.size() == 0)
+        return -1;
+
+    int next = waiting.pop();
+    plug_In(next);
+    return next;
+}
+
+/**
+ * @brief Brings a charging vehicle's battery and charging time up to the current time.
+ * 
+ * Its completion time does not change, so it stays where it is in the heap.
+ * 
+ * @param id Fleet id of the vehicle; ignored unless it is charging.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::sync(int id)
+{
+    if (is_Charging(id))
+        fleet.charge_Until(id, clock);
+}
+
+/**
+ * @brief Brings every charging vehicle's battery and charging time up to the current time.
+ * 
+ * O(n) in the number of chargers; call it before reading the fleet directly, e.g. at the end of a run.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::sync()
+{
+    for (int id : charging_Vehicles)
+    {
+        fleet.charge_Until(id, clock);
     }
+}
+
+/**
+ * @brief Writes the charger count, clock, charger slots, completion heap and queue to a checkpoint.
+ * 
+ * The vehicles' own charger state is part of the fleet and is written with it.
+ * 
+ * @param out Checkpoint being written.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::save(CheckpointWriter &out) const
+{
+    out.write(maxChargers);
+    out.write(clock);
+    out.write(charging_Vehicles);
+    finishing.save(out);
+    waiting.save(out);
+}
+
+/**
+ * @brief Replaces the charger count, clock, slots, completion heap and queue with those written by save().
+ * 
+ * The fleet must already hold the state saved alongside, so every vehicle on a slot is
+ * marked as charging in that slot.
+ * 
+ * @param in Checkpoint positioned at the manager.
+ * @return true if the manager was read and agrees with the fleet; false otherwise.
+ */
+template <class Queue>
+bool BasicChargerManager<Queue>::load(CheckpointReader &in)
+{
+    if (!in.read(maxChargers) || !in.read(clock) || !in.read(charging_Vehicles) || maxChargers < 0 ||
+        charging_Vehicles.size() > static_cast<size_t>(maxChargers))
+        return false;
+
+    charging_Vehicles.reserve(maxChargers);
+    finishing.reserve(fleet.size(), maxChargers);
+    if (!finishing.load(in, fleet.size()) || finishing.size() != charging_Vehicles.size())
+        return false;
 
-    charging_Vehicles = stillCharging;                                 // Updates the vector for vehicles still needing charging
-    
-    while(!waiting_Queue.empty() && charger_Availability())
+    for (size_t slot = 0; slot < charging_Vehicles.size(); ++slot)
     {
-        VehicleInstance *next = waiting_Queue.front();
-        waiting_Queue.pop();
-        charging_Vehicles.push_back(next);
+        int id = charging_Vehicles[slot];
+        if (id < 0 || static_cast<size_t>(id) >= fleet.size() || fleet.charge_State[id] != ChargeState::Charging ||
+            fleet.charger_Slot[id] != static_cast<int>(slot) || !finishing.contains(id))
+            return false;
     }
-    
+    return waiting.load(in, fleet);
 }
 
 /**
- * @brief Resets the charger manager by clearing the queue, charging list, and known vehicle tracker.
+ * @brief Resets the charger manager by clearing the queue and charger slots.
+ * 
+ * Only the vehicles this manager holds are set back to idle, keeping the charge they
+ * gained up to the current time.
  */
-void ChargerManager::reset() 
+template <class Queue>
+void BasicChargerManager<Queue>::reset() 
 {
+    sync();
+    for (int id : charging_Vehicles)
+    {
+        fleet.charge_State[id] = ChargeState::Idle;
+        fleet.charger_Slot[id] = -1;
+    }
     charging_Vehicles.clear();
-    while (!waiting_Queue.empty()) waiting_Queue.pop();
-    known_Vehicles.clear();
-}
\ No newline at end of file
+    finishing.clear();
+
+    while (waiting.size() > 0)
+    {
+        fleet.charge_State[waiting.pop()] = ChargeState::Idle;
+    }
+}
+
+/**
+ * @brief Sets the current time used to measure queue waits.
+ * 
+ * Used by the event-driven engine, which releases chargers at exact event times instead of
+ * stepping charge_Update.
+ * 
+ * @param time Current simulation time.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::set_Clock(double time)
+{
+    clock = time;
+}
+
+/**
+ * @brief Sends the charges and waits logged from now on to another Statistics object.
+ * 
+ * Lets a caller updating several managers at once give each its own Statistics shard.
+ * 
+ * @param statsRef Statistics to log into.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::set_Statistics(Statistics& statsRef)
+{
+    stats = &statsRef;
+}
+
+/**
+ * @brief Recomputes a queued vehicle's place in the queue after its state changed.
+ * 
+ * O(log n) for the heap-based policies, nothing to do for FIFO.
+ * 
+ * @param id Fleet id of the vehicle; ignored unless it is queued.
+ */
+template <class Queue>
+void BasicChargerManager<Queue>::reprioritize(int id)
+{
+    if (is_Waiting(id))
+        waiting.update(fleet, id);
+}
+
+/**
+ * @brief Returns the admission policy, e.g. to set weighted fair queueing weights.
+ * 
+ * @return Queue& The queue holding the waiting vehicles.
+ */
+template <class Queue>
+Queue& BasicChargerManager<Queue>::get_Queue()
+{
+    return waiting;
+}
+
+template class BasicChargerManager<FifoQueue>;
+template class BasicChargerManager<ShortestChargeQueue>;
+template class BasicChargerManager<LowestBatteryQueue>;
+template class BasicChargerManager<WeightedFairQueue>;
\ No newline at end of file
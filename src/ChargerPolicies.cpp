@@ -0,0 +1,234 @@
+#include "ChargerPolicies.h"
+
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Creates an empty queue; the ring is allocated by the first reserve().
+ * 
+ * @param resource Memory the ring allocates from.
+ */
+FifoQueue::FifoQueue(pmr::memory_resource *resource):ring(resource){}
+
+/**
+ * @brief Makes sure the ring can hold every vehicle of a fleet.
+ * 
+ * A vehicle is queued at most once, so a ring as large as the fleet never fills. The ring
+ * is only rebuilt when the fleet has grown past its capacity, and queued vehicles keep
+ * their order.
+ * 
+ * @param vehicles Number of vehicles in the fleet.
+ */
+void FifoQueue::reserve(size_t vehicles)
+{
+    if (vehicles <= ring.size())
+        return;
+
+    size_t capacity = 16;
+    while (capacity < vehicles)
+        capacity *= 2;
+
+    pmr::vector<int> grown(capacity, ring.get_allocator());
+    for (size_t i = 0; i < count; ++i)
+    {
+        grown[i] = ring[(head + i) & (ring.size() - 1)];
+    }
+    ring.swap(grown);
+    head = 0;
+}
+
+/**
+ * @brief Appends a vehicle to the back of the ring.
+ * 
+ * @param fleet Fleet holding the vehicle, unused by this policy.
+ * @param id Fleet id of the vehicle to queue.
+ */
+void FifoQueue::push(const VehicleFleet &/*fleet*/, int id)
+{
+    if (count == ring.size())
+        reserve(count + 1);
+
+    ring[(head + count) & (ring.size() - 1)] = id;
+    count++;
+}
+
+/**
+ * @brief Removes the vehicle at the front of the ring.
+ * 
+ * @return int Fleet id of the vehicle that has waited longest; the queue must not be empty.
+ */
+int FifoQueue::pop()
+{
+    int id = ring[head];
+    head = (head + 1) & (ring.size() - 1);
+    count--;
+    return id;
+}
+
+/**
+ * @brief Keeps a vehicle's place; arrival order does not depend on vehicle state.
+ * 
+ * @param fleet Fleet holding the vehicle, unused by this policy.
+ * @param id Fleet id of the vehicle, unused by this policy.
+ */
+void FifoQueue::update(const VehicleFleet &/*fleet*/, int /*id*/) {}
+
+/**
+ * @brief Returns the number of queued vehicles.
+ * 
+ * @return size_t Queue length.
+ */
+size_t FifoQueue::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Returns the vehicle at a place in the queue.
+ * 
+ * @param index Place in the queue, 0 for the vehicle waiting longest; below size().
+ * @return int Fleet id of the vehicle.
+ */
+int FifoQueue::at(size_t index) const
+{
+    return ring[(head + index) & (ring.size() - 1)];
+}
+
+/**
+ * @brief Writes the queued vehicles to a checkpoint, longest waiting first.
+ * 
+ * @param out Checkpoint being written.
+ */
+void FifoQueue::save(CheckpointWriter &out) const
+{
+    vector<int> ids(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ids[i] = ring[(head + i) & (ring.size() - 1)];
+    }
+    out.write(ids);
+}
+
+/**
+ * @brief Replaces the queue with the vehicles written by save(), in the same order.
+ * 
+ * @param in Checkpoint positioned at the queue.
+ * @param fleet Fleet the queued ids refer to.
+ * @return true if the queue was read and holds distinct fleet vehicles marked as queued; false otherwise.
+ */
+bool FifoQueue::load(CheckpointReader &in, const VehicleFleet &fleet)
+{
+    vector<int> ids;
+    head = count = 0;
+    if (!in.read(ids))
+        return false;
+
+    vector<char> seen(fleet.size(), 0);
+    reserve(max(fleet.size(), ids.size()));
+    for (int id : ids)
+    {
+        if (id < 0 || static_cast<size_t>(id) >= fleet.size() || seen[id] || fleet.charge_State[id] != ChargeState::Queued)
+        {
+            head = count = 0;
+            return false;
+        }
+        seen[id] = 1;
+        push(fleet, id);
+    }
+    return true;
+}
+
+/**
+ * @brief Returns the hours of charging a vehicle still needs.
+ * 
+ * @param fleet Fleet holding the vehicle's state.
+ * @param id Fleet id of the vehicle.
+ * @return double Key of the vehicle, shorter charges first.
+ */
+double ShortestChargePriority::key(const VehicleFleet &fleet, int id)
+{
+    return fleet.time_ToFullCharge(id);
+}
+
+/**
+ * @brief Returns the fraction of battery capacity a vehicle has left.
+ * 
+ * @param fleet Fleet holding the vehicle's state.
+ * @param id Fleet id of the vehicle.
+ * @return double Key of the vehicle, emptier batteries first.
+ */
+double LowestBatteryPriority::key(const VehicleFleet &fleet, int id)
+{
+    return fleet.battery_Capacity[id] > 0.0 ? fleet.current_Battery[id] / fleet.battery_Capacity[id] : 0.0;
+}
+
+/**
+ * @brief Sets the share of charger time a vehicle type receives when types compete.
+ * 
+ * @param type Registered id of the vehicle type.
+ * @param weight Relative share, must be positive.
+ */
+void WeightedFairPriority::set_Weight(TypeId type, double weight)
+{
+    if (type < 0 || weight <= 0.0)
+        return;
+    if (static_cast<size_t>(type) >= weights.size())
+        weights.resize(type + 1, 1.0);
+    weights[type] = weight;
+}
+
+/**
+ * @brief Stamps a vehicle with its virtual finish time.
+ * 
+ * Each call queues a new unit of work for the vehicle's type, so a priority update
+ * restamps the vehicle behind the rest of its type.
+ * 
+ * @param fleet Fleet holding the vehicle's state.
+ * @param id Fleet id of the vehicle.
+ * @return double Virtual finish time, earliest first.
+ */
+double WeightedFairPriority::key(const VehicleFleet &fleet, int id)
+{
+    TypeId type = fleet.type_Id[id];
+    if (static_cast<size_t>(type) >= last_Finish.size())
+        last_Finish.resize(type + 1, 0.0);
+
+    double weight = static_cast<size_t>(type) < weights.size() ? weights[type] : 1.0;
+    double start = max(virtual_Time, last_Finish[type]);
+    last_Finish[type] = start + fleet.time_ToFullCharge(id) / weight;
+    return last_Finish[type];
+}
+
+/**
+ * @brief Advances the virtual time to the finish time of the vehicle being served.
+ * 
+ * @param key Virtual finish time of the vehicle leaving the queue.
+ */
+void WeightedFairPriority::served(double key)
+{
+    virtual_Time = max(virtual_Time, key);
+}
+
+/**
+ * @brief Writes the type weights and virtual times to a checkpoint.
+ * 
+ * @param out Checkpoint being written.
+ */
+void WeightedFairPriority::save(CheckpointWriter &out) const
+{
+    out.write(weights);
+    out.write(last_Finish);
+    out.write(virtual_Time);
+}
+
+/**
+ * @brief Replaces the type weights and virtual times with those written by save().
+ * 
+ * @param in Checkpoint positioned at the policy.
+ * @return true if the state was read; false otherwise.
+ */
+bool WeightedFairPriority::load(CheckpointReader &in)
+{
+    return in.read(weights) && in.read(last_Finish) && in.read(virtual_Time);
+}
\ No newline at end of file
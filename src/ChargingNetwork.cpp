@@ -0,0 +1,420 @@
+#include "ChargingNetwork.h"
+
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Constructs a network with a single site.
+ * 
+ * @param statsRef Reference to the Statistics object that charging sessions are merged into.
+ * @param fleetRef Reference to the fleet whose vehicles are charged.
+ * @param chargers_Available Number of chargers at the single site (default maximum = 3).
+ */
+ChargingNetwork::ChargingNetwork(Statistics& statsRef, VehicleFleet& fleetRef, int chargers_Available)
+    : home_Site(fleetRef.resource()), stats(statsRef), fleet(fleetRef)
+{
+    sites.push_back(make_unique<ChargerManager>(stats, fleet, chargers_Available));
+    site_Stats.resize(1);
+}
+
+/**
+ * @brief Replaces every site with a new set of empty sites.
+ * 
+ * Vehicles held by the old sites are set back to idle. Explicit home sites that no longer
+ * exist fall back to the default assignment.
+ * 
+ * @param charger_Counts Number of chargers at each new site; an empty list leaves the network unchanged.
+ */
+void ChargingNetwork::set_Sites(const vector<int> &charger_Counts)
+{
+    if (charger_Counts.empty())
+        return;
+
+    reset();
+    sites.clear();
+    for (int count : charger_Counts)
+    {
+        sites.push_back(make_unique<ChargerManager>(stats, fleet, count));
+    }
+    site_Stats.resize(sites.size());
+}
+
+/**
+ * @brief Assigns a vehicle to a home site.
+ * 
+ * Ignored while the vehicle is queued or charging, so a site never loses track of a vehicle it holds.
+ * 
+ * @param id Fleet id of the vehicle.
+ * @param site Index of the site, below site_Count().
+ */
+void ChargingNetwork::set_HomeSite(int id, int site)
+{
+    if (id < 0 || site < 0 || static_cast<size_t>(site) >= sites.size())
+        return;
+    if (static_cast<size_t>(id) < fleet.size() && fleet.charge_State[id] != ChargeState::Idle)
+        return;
+
+    if (static_cast<size_t>(id) >= home_Site.size())
+        home_Site.resize(id + 1, -1);
+    home_Site[id] = site;
+}
+
+/**
+ * @brief Sets how many threads charge_Update may spread the sites over.
+ * 
+ * @param threads Thread count; 1 updates every site on the calling thread.
+ */
+void ChargingNetwork::set_Threads(size_t threads)
+{
+    thread_Count = max<size_t>(threads, 1);
+    pool.reset();
+}
+
+/**
+ * @brief Sets the current time used to measure queue waits.
+ * 
+ * Sites pick the time up the next time one of their vehicles requests or releases a charger.
+ * 
+ * @param time Current simulation time.
+ */
+void ChargingNetwork::set_Clock(double time)
+{
+    clock = time;
+}
+
+/**
+ * @brief Returns the number of sites.
+ * 
+ * @return size_t Site count.
+ */
+size_t ChargingNetwork::site_Count() const
+{
+    return sites.size();
+}
+
+/**
+ * @brief Returns the site a vehicle charges at.
+ * 
+ * @param id Fleet id of the vehicle.
+ * @return int Explicit home site if one was set, otherwise id modulo the number of sites.
+ */
+int ChargingNetwork::site_Of(int id) const
+{
+    if (id >= 0 && static_cast<size_t>(id) < home_Site.size() && home_Site[id] >= 0 &&
+        static_cast<size_t>(home_Site[id]) < sites.size())
+        return home_Site[id];
+    return id >= 0 ? static_cast<int>(id % sites.size()) : 0;
+}
+
+/**
+ * @brief Returns the chargers of one site.
+ * 
+ * @param index Site index, below site_Count().
+ * @return ChargerManager& Used to inspect or drive a single site.
+ */
+ChargerManager& ChargingNetwork::site(int index)
+{
+    return *sites[index];
+}
+
+/**
+ * @brief Returns the chargers of a vehicle's home site with the site clock set to the network clock.
+ * 
+ * @param id Fleet id of the vehicle.
+ * @return ChargerManager& Chargers of the home site.
+ */
+ChargerManager& ChargingNetwork::home(int id)
+{
+    ChargerManager &chargers = *sites[site_Of(id)];
+    chargers.set_Clock(clock);
+    return chargers;
+}
+
+/**
+ * @brief Handles a vehicle's request to charge at its home site.
+ * 
+ * @param id Fleet id of the vehicle requesting a charge.
+ */
+void ChargingNetwork::charge_Request(int id)
+{
+    home(id).charge_Request(id);
+}
+
+/**
+ * @brief Handles charge requests from several vehicles at once.
+ * 
+ * Requests reach each site in the order given.
+ * 
+ * @param ids Fleet ids of the vehicles requesting a charge, in request order.
+ * @param count Number of ids.
+ */
+void ChargingNetwork::charge_Request(const int *ids, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        charge_Request(ids[i]);
+    }
+}
+
+/**
+ * @brief Progresses charging at a contiguous range of sites.
+ * 
+ * @param begin First site of the shard.
+ * @param end One past the last site of the shard.
+ * @param time_increment Time in hours to simulate charging progression.
+ */
+void ChargingNetwork::update_Sites(size_t begin, size_t end, double time_increment)
+{
+    for (size_t s = begin; s < end; ++s)
+    {
+        sites[s]->charge_Update(time_increment);
+    }
+}
+
+/**
+ * @brief Progresses charging at every site for one time step.
+ * 
+ * With more than one thread the sites are split into equal contiguous shards that are
+ * updated concurrently. With more than one site, each logs into its own Statistics for
+ * the update, merged into the shared Statistics in site order afterwards, so the serial
+ * and parallel updates give identical results. A single site logs directly.
+ * 
+ * @param time_increment Time in hours to simulate charging progression.
+ */
+void ChargingNetwork::charge_Update(double time_increment)
+{
+    if (sites.size() == 1)
+    {
+        sites[0]->set_Clock(clock);
+        sites[0]->charge_Update(time_increment);
+        clock += time_increment;
+        return;
+    }
+
+    site_Stats.prepare(stats);
+    for (size_t s = 0; s < sites.size(); ++s)
+    {
+        sites[s]->set_Statistics(site_Stats[s]);
+        sites[s]->set_Clock(clock);
+    }
+
+    size_t shards = min(thread_Count, sites.size());
+    if (shards <= 1)
+    {
+        update_Sites(0, sites.size(), time_increment);
+    }
+    else
+    {
+        if (!pool)
+            pool = make_unique<ThreadPool>(thread_Count);
+
+        for (size_t s = 0; s < shards; ++s)
+        {
+            size_t begin = sites.size() * s / shards;
+            size_t end = sites.size() * (s + 1) / shards;
+            pool->submit([this, begin, end, time_increment] { update_Sites(begin, end, time_increment); });
+        }
+        pool->wait_Idle();
+    }
+
+    for (auto &site : sites)
+    {
+        site->set_Statistics(stats);
+    }
+    site_Stats.merge_Into(stats);
+    clock += time_increment;
+}
+
+/**
+ * @brief Checks if any site has a free charger.
+ * 
+ * @return true if at least one site can plug a vehicle in, false otherwise.
+ */
+bool ChargingNetwork::charger_Availability() const
+{
+    for (const auto &site : sites)
+    {
+        if (site->charger_Availability())
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Checks if a vehicle is currently occupying a charger.
+ * 
+ * @param id Fleet id of the vehicle to look up.
+ * @return true if the vehicle is charging, false if it is queued or unknown.
+ */
+bool ChargingNetwork::is_Charging(int id) const
+{
+    return sites[site_Of(id)]->is_Charging(id);
+}
+
+/**
+ * @brief Checks if a vehicle is waiting in its home site's queue.
+ * 
+ * @param id Fleet id of the vehicle to look up.
+ * @return true if the vehicle is queued, false if it is charging or unknown.
+ */
+bool ChargingNetwork::is_Waiting(int id) const
+{
+    return sites[site_Of(id)]->is_Waiting(id);
+}
+
+/**
+ * @brief Returns the number of vehicles waiting across every site.
+ * 
+ * @return size_t Sum of the site queue lengths.
+ */
+size_t ChargingNetwork::queue_Length() const
+{
+    size_t total = 0;
+    for (const auto &site : sites)
+    {
+        total += site->queue_Length();
+    }
+    return total;
+}
+
+/**
+ * @brief Releases the charger held by a vehicle that has finished charging.
+ * 
+ * Only the vehicle's home site is touched; the front of that site's queue takes over.
+ * 
+ * @param id Fleet id of the vehicle leaving its charger.
+ * @return int Id of the vehicle promoted from the queue, or -1 if none was waiting.
+ */
+int ChargingNetwork::charge_Release(int id)
+{
+    return home(id).charge_Release(id);
+}
+
+/**
+ * @brief Brings the battery of every vehicle on a charger, at every site, up to the current time.
+ * 
+ * Sites charge lazily, see ChargerManager; call this before reading charging vehicles' batteries from the fleet.
+ */
+void ChargingNetwork::sync()
+{
+    for (auto &site : sites)
+    {
+        site->set_Clock(clock);
+        site->sync();
+    }
+}
+
+/**
+ * @brief Empties the chargers and queue of every site.
+ * 
+ * Vehicles on a charger keep the charge they gained up to the current time.
+ */
+void ChargingNetwork::reset()
+{
+    for (auto &site : sites)
+    {
+        site->set_Clock(clock);
+        site->reset();
+    }
+}
+
+/**
+ * @brief Writes the home sites, the clock and every site's chargers and queue to a checkpoint.
+ * 
+ * @param out Checkpoint being written.
+ */
+void ChargingNetwork::save(CheckpointWriter &out) const
+{
+    out.write(home_Site);
+    out.write(clock);
+    out.write(static_cast<uint64_t>(sites.size()));
+    for (const auto &site : sites)
+    {
+        site->save(out);
+    }
+}
+
+/**
+ * @brief Checks that the fleet's charger state and the sites describe the same vehicles.
+ * 
+ * Each site already checked its own slots and queue against the fleet; this walks the fleet
+ * the other way. A charging vehicle must sit in its home site's slot at charger_Slot, a
+ * queued vehicle must be in its home site's queue exactly once, and every other vehicle
+ * must be idle with no slot. Every occupied slot must then belong to a charging vehicle's
+ * home site.
+ * 
+ * @return true if the fleet and the sites agree; false otherwise.
+ */
+bool ChargingNetwork::check_Fleet() const
+{
+    vector<int> queued(fleet.size(), 0);                    // Times each vehicle is found in its home site's queue
+    size_t slots = 0;                                       // Occupied charger slots over every site
+    for (size_t s = 0; s < sites.size(); ++s)
+    {
+        slots += sites[s]->charging_Count();
+        for (size_t i = 0; i < sites[s]->queue_Length(); ++i)
+        {
+            int id = sites[s]->queued_At(i);
+            if (static_cast<size_t>(site_Of(id)) != s)
+                return false;
+            queued[id]++;
+        }
+    }
+
+    for (size_t i = 0; i < fleet.size(); ++i)
+    {
+        int id = static_cast<int>(i);
+        switch (fleet.charge_State[i])
+        {
+            case ChargeState::Idle:
+                if (fleet.charger_Slot[i] != -1 || queued[i] != 0)
+                    return false;
+                break;
+            case ChargeState::Queued:
+                if (fleet.charger_Slot[i] != -1 || queued[i] != 1)
+                    return false;
+                break;
+            case ChargeState::Charging:
+                if (!sites[site_Of(id)]->holds(id) || queued[i] != 0)
+                    return false;
+                slots--;
+                break;
+            default:
+                return false;                                 // Not a state a saved fleet can hold
+        }
+    }
+    return slots == 0;                                      // No vehicle holds a slot at a second site
+}
+
+/**
+ * @brief Replaces the network with the sites written by save().
+ * 
+ * The old sites are dropped without touching the fleet, which must already hold the state
+ * saved alongside. The thread count is kept.
+ * 
+ * @param in Checkpoint positioned at the network.
+ * @return true if every site was read and agrees with the fleet; false otherwise, leaving a single empty site of 3 chargers.
+ */
+bool ChargingNetwork::load(CheckpointReader &in)
+{
+    uint64_t count = 0;
+    bool ok = in.read(home_Site) && in.read(clock) && in.read(count) && count > 0;
+
+    sites.clear();
+    for (uint64_t i = 0; ok && i < count; ++i)
+    {
+        sites.push_back(make_unique<ChargerManager>(stats, fleet, 0));
+        ok = sites.back()->load(in);
+    }
+    ok = ok && check_Fleet();
+
+    if (!ok)
+    {
+        sites.clear();
+        home_Site.clear();
+        sites.push_back(make_unique<ChargerManager>(stats, fleet, 3));
+    }
+    site_Stats.resize(sites.size());
+    return ok;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include <cstdio>
+#include <fstream>
+
+#include "Checkpoint.h"
+
+using namespace std;
+
+namespace {
+    const uint32_t checkpoint_Version = 3;          // Format written by this build
+    const uint32_t byte_Order = 0x01020304;         // Reads back unchanged only on a machine with the same byte order
+}
+
+/**
+ * @brief Appends a string as its length followed by its characters.
+ *
+ * @param text String to store.
+ */
+void CheckpointWriter::write(const string &text)
+{
+    write(static_cast<uint64_t>(text.size()));
+    body.insert(body.end(), text.begin(), text.end());
+}
+
+/**
+ * @brief Starts an empty state, keeping room for the header at the front of the buffer.
+ */
+CheckpointWriter::CheckpointWriter():body(sizeof(CheckpointHeader)){}
+
+/**
+ * @brief Builds the header describing the state written so far.
+ */
+CheckpointHeader CheckpointWriter::header() const
+{
+    CheckpointHeader header{};
+    memcpy(header.magic, "EVCHKPT", 8);
+    header.version = checkpoint_Version;
+    header.byte_Order = byte_Order;
+    header.body_Bytes = body.size() - sizeof(CheckpointHeader);
+    return header;
+}
+
+/**
+ * @brief Writes the header and every section collected so far to a file.
+ *
+ * The checkpoint is written to a temporary file next to path and renamed over it only once
+ * complete, so a run preempted while saving keeps its previous checkpoint.
+ *
+ * @param path File to write.
+ * @return true if the whole checkpoint was written; false otherwise.
+ */
+bool CheckpointWriter::save(const string &path) const
+{
+    CheckpointHeader header = this->header();
+
+    string temp = path + ".tmp";
+    {
+        ofstream file(temp, ios::out | ios::binary | ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(body.data() + sizeof(header), static_cast<streamsize>(body.size() - sizeof(header)));
+        if (!file.good())
+        {
+            file.close();
+            remove(temp.c_str());
+            return false;
+        }
+    }
+
+    if (rename(temp.c_str(), path.c_str()) != 0)
+    {
+        remove(path.c_str());                       // Windows will not rename over an existing file
+        if (rename(temp.c_str(), path.c_str()) != 0)
+        {
+            remove(temp.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Hands over the header and every section collected so far as one buffer.
+ *
+ * The header is filled into the room kept for it and the buffer is moved out, so the state
+ * is not copied again. The writer is left empty.
+ *
+ * @return std::vector<char> The bytes save() would write to a file.
+ */
+vector<char> CheckpointWriter::take_Image()
+{
+    CheckpointHeader header = this->header();
+    memcpy(body.data(), &header, sizeof(header));
+
+    vector<char> bytes = move(body);
+    body.assign(sizeof(CheckpointHeader), 0);
+    return bytes;
+}
+
+/**
+ * @brief Reads a string written by CheckpointWriter.
+ *
+ * @param text Receives the string.
+ * @return true if the string was read; false past the end of the state.
+ */
+bool CheckpointReader::read(string &text)
+{
+    uint64_t size = 0;
+    if (!read(size))
+        return false;
+
+    const char *p = take(size);
+    if (!p)
+        return false;
+    text.assign(p, static_cast<size_t>(size));
+    return true;
+}
+
+/**
+ * @brief Maps a checkpoint file and checks its header.
+ *
+ * @param path Checkpoint written by CheckpointWriter::save.
+ * @return true if the file is a complete checkpoint of this version; false otherwise.
+ */
+bool CheckpointReader::open(const string &path)
+{
+    ok = false;
+    body = nullptr;
+    length = offset = 0;
+
+    if (!file.open(path))
+        return false;
+    return open(file.data(), file.size());
+}
+
+/**
+ * @brief Reads a checkpoint image held in memory, e.g. one returned by CheckpointWriter::take_Image.
+ *
+ * Nothing is copied: the caller keeps the image alive while reading. Several readers may
+ * read one image at the same time.
+ *
+ * @param data First byte of the image.
+ * @param size Bytes in the image.
+ * @return true if the image is a complete checkpoint of this version; false otherwise.
+ */
+bool CheckpointReader::open(const char *data, size_t size)
+{
+    ok = false;
+    body = nullptr;
+    length = offset = 0;
+
+    if (!data || size < sizeof(CheckpointHeader))
+        return false;
+
+    CheckpointHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, "EVCHKPT", 8) != 0 || header.version != checkpoint_Version ||
+        header.byte_Order != byte_Order || header.body_Bytes != size - sizeof(CheckpointHeader))
+        return false;
+
+    body = data + sizeof(CheckpointHeader);
+    length = static_cast<size_t>(header.body_Bytes);
+    ok = true;
+    return true;
+}
+
+/**
+ * @brief Checks whether every read so far succeeded.
+ */
+bool CheckpointReader::good() const
+{
+    return ok;
+}
+
+/**
+ * @brief Checks whether the whole state has been read.
+ */
+bool CheckpointReader::at_End() const
+{
+    return ok && offset == length;
+}
\ No newline at end of file
@@ -0,0 +1,378 @@
+#include "Distribution.h"
+
+#include <cmath>
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+    const double gamma_Base = (1.0 + 0.01) / (1.0 - 0.01);     // Growth factor between bucket bounds, from the sketch accuracy
+    const double log_Gamma = log(gamma_Base);                   // Natural log of gamma_Base
+}
+
+/**
+ * @brief Returns the index of the bucket holding a value.
+ *
+ * Bucket i holds the values in (gamma^(i-1), gamma^i].
+ *
+ * @param value Positive value above min_Value.
+ * @return int Bucket index.
+ */
+int QuantileSketch::bucket_Of(double value)
+{
+    static_assert(accuracy == 0.01, "gamma_Base is derived from an accuracy of 0.01");
+    return static_cast<int>(ceil(log(value) / log_Gamma));
+}
+
+/**
+ * @brief Returns the value reported for a bucket.
+ *
+ * The point 2 * gamma^i / (gamma + 1) lies within the relative accuracy of both bounds.
+ *
+ * @param index Bucket index.
+ * @return double Representative value.
+ */
+double QuantileSketch::bucket_Value(int index)
+{
+    return 2.0 * exp(index * log_Gamma) / (gamma_Base + 1.0);
+}
+
+/**
+ * @brief Adds counts to a bucket, growing the bucket range as needed.
+ *
+ * If the range would exceed max_Buckets, the lowest buckets are folded into the lowest
+ * one kept, and a value that falls below it is counted there.
+ *
+ * @param index Bucket index.
+ * @param count Number of values to add.
+ */
+void QuantileSketch::add_ToBucket(int index, uint64_t count)
+{
+    if (buckets.empty())
+    {
+        offset = index;
+        buckets.assign(1, count);
+        return;
+    }
+
+    int top = max(offset + static_cast<int>(buckets.size()) - 1, index);
+    int floor = top - static_cast<int>(max_Buckets) + 1;
+    if (min(offset, index) < floor)
+    {
+        if (offset < floor)
+        {
+            size_t drop = min(buckets.size(), static_cast<size_t>(floor - offset));
+            uint64_t folded = 0;
+            for (size_t i = 0; i < drop; ++i)
+            {
+                folded += buckets[i];
+            }
+            buckets.erase(buckets.begin(), buckets.begin() + drop);
+            if (buckets.empty())
+                buckets.push_back(0);
+            offset = floor;
+            buckets[0] += folded;
+        }
+        index = max(index, floor);
+    }
+
+    if (index < offset)
+    {
+        buckets.insert(buckets.begin(), offset - index, 0);
+        offset = index;
+    }
+    if (index >= offset + static_cast<int>(buckets.size()))
+        buckets.resize(index - offset + 1, 0);
+    buckets[index - offset] += count;
+}
+
+/**
+ * @brief Counts one value.
+ *
+ * @param value Value to add; values at or below min_Value count as zero.
+ */
+void QuantileSketch::add(double value)
+{
+    total++;
+    if (value <= min_Value)
+        zero_Count++;
+    else
+        add_ToBucket(bucket_Of(value), 1);
+}
+
+/**
+ * @brief Adds every count of another sketch to this one.
+ *
+ * The result is the sketch that would have been built from both sets of values.
+ *
+ * @param other Sketch filled elsewhere, e.g. by another thread or replica.
+ */
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+    total += other.total;
+    zero_Count += other.zero_Count;
+    for (size_t i = 0; i < other.buckets.size(); ++i)
+    {
+        if (other.buckets[i] > 0)
+            add_ToBucket(other.offset + static_cast<int>(i), other.buckets[i]);
+    }
+}
+
+/**
+ * @brief Forgets every counted value without releasing the bucket memory.
+ */
+void QuantileSketch::clear()
+{
+    buckets.clear();
+    offset = 0;
+    zero_Count = 0;
+    total = 0;
+}
+
+/**
+ * @brief Writes the sketch to a checkpoint.
+ *
+ * @param out Checkpoint being written.
+ */
+void QuantileSketch::save(CheckpointWriter &out) const
+{
+    out.write(buckets);
+    out.write(offset);
+    out.write(zero_Count);
+    out.write(total);
+}
+
+/**
+ * @brief Replaces the sketch with one written by save().
+ *
+ * @param in Checkpoint positioned at the sketch.
+ * @return true if the sketch was read and fits the bucket limit; false otherwise.
+ */
+bool QuantileSketch::load(CheckpointReader &in)
+{
+    return in.read(buckets) && in.read(offset) && in.read(zero_Count) && in.read(total) && buckets.size() <= max_Buckets;
+}
+
+/**
+ * @brief Returns the value below which a fraction of the counted values lie.
+ *
+ * @param q Quantile in [0, 1], e.g. 0.99 for the 99th percentile.
+ * @return double Estimate within the sketch accuracy of a counted value, or 0 if the sketch is empty.
+ */
+double QuantileSketch::quantile(double q) const
+{
+    if (total == 0)
+        return 0.0;
+
+    q = min(max(q, 0.0), 1.0);
+    double rank = q * static_cast<double>(total - 1);
+    uint64_t seen = zero_Count;
+    if (rank < seen)
+        return 0.0;
+
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (rank < seen)
+            return bucket_Value(offset + static_cast<int>(i));
+    }
+    return bucket_Value(offset + static_cast<int>(buckets.size()) - 1);
+}
+
+/**
+ * @brief Returns the number of values counted.
+ *
+ * @return uint64_t Value count.
+ */
+uint64_t QuantileSketch::count() const
+{
+    return total;
+}
+
+/**
+ * @brief Returns the number of buckets in use.
+ *
+ * @return size_t Bucket count, at most max_Buckets.
+ */
+size_t QuantileSketch::bucket_Count() const
+{
+    return buckets.size();
+}
+
+/**
+ * @brief Records one value.
+ *
+ * @param value Observed value.
+ */
+void Distribution::add(double value)
+{
+    samples++;
+    double delta = value - mean_Value;
+    mean_Value += delta / samples;
+    m2 += delta * (value - mean_Value);
+
+    min_Seen = samples == 1 ? value : std::min(min_Seen, value);
+    max_Seen = samples == 1 ? value : std::max(max_Seen, value);
+    sketch.add(value);
+}
+
+/**
+ * @brief Combines another summary into this one.
+ *
+ * @param other Summary of a disjoint set of values.
+ */
+void Distribution::merge(const Distribution &other)
+{
+    if (other.samples == 0)
+        return;
+    if (samples == 0)
+    {
+        *this = other;
+        return;
+    }
+
+    uint64_t n = samples + other.samples;
+    double delta = other.mean_Value - mean_Value;
+    mean_Value += delta * other.samples / n;
+    m2 += other.m2 + delta * delta * (static_cast<double>(samples) * other.samples / n);
+    samples = n;
+
+    min_Seen = std::min(min_Seen, other.min_Seen);
+    max_Seen = std::max(max_Seen, other.max_Seen);
+    sketch.merge(other.sketch);
+}
+
+/**
+ * @brief Forgets every recorded value without releasing the sketch memory.
+ */
+void Distribution::clear()
+{
+    samples = 0;
+    mean_Value = 0.0;
+    m2 = 0.0;
+    min_Seen = 0.0;
+    max_Seen = 0.0;
+    sketch.clear();
+}
+
+/**
+ * @brief Writes the summary and its sketch to a checkpoint.
+ *
+ * @param out Checkpoint being written.
+ */
+void Distribution::save(CheckpointWriter &out) const
+{
+    out.write(samples);
+    out.write(mean_Value);
+    out.write(m2);
+    out.write(min_Seen);
+    out.write(max_Seen);
+    sketch.save(out);
+}
+
+/**
+ * @brief Replaces the summary with one written by save().
+ *
+ * @param in Checkpoint positioned at the summary.
+ * @return true if the summary was read; false otherwise.
+ */
+bool Distribution::load(CheckpointReader &in)
+{
+    return in.read(samples) && in.read(mean_Value) && in.read(m2) && in.read(min_Seen) && in.read(max_Seen) && sketch.load(in);
+}
+
+/**
+ * @brief Returns the number of values recorded.
+ *
+ * @return uint64_t Value count.
+ */
+uint64_t Distribution::count() const
+{
+    return samples;
+}
+
+/**
+ * @brief Returns the mean of the values.
+ *
+ * @return double Mean, or 0 if nothing was recorded.
+ */
+double Distribution::mean() const
+{
+    return mean_Value;
+}
+
+/**
+ * @brief Returns the unbiased sample variance.
+ *
+ * @return double Variance, or 0 with fewer than two values.
+ */
+double Distribution::variance() const
+{
+    return samples > 1 ? m2 / (samples - 1) : 0.0;
+}
+
+/**
+ * @brief Returns the sample standard deviation.
+ *
+ * @return double Square root of the variance.
+ */
+double Distribution::stddev() const
+{
+    return sqrt(variance());
+}
+
+/**
+ * @brief Returns the smallest value recorded.
+ *
+ * @return double Minimum, or 0 if nothing was recorded.
+ */
+double Distribution::min() const
+{
+    return min_Seen;
+}
+
+/**
+ * @brief Returns the largest value recorded.
+ *
+ * @return double Maximum, or 0 if nothing was recorded.
+ */
+double Distribution::max() const
+{
+    return max_Seen;
+}
+
+/**
+ * @brief Returns an approximate quantile of the values.
+ *
+ * @param q Quantile in [0, 1].
+ * @return double Sketch estimate clamped to the observed range, so p0 and p100 are exact.
+ */
+double Distribution::quantile(double q) const
+{
+    if (samples == 0)
+        return 0.0;
+    return std::min(std::max(sketch.quantile(q), min_Seen), max_Seen);
+}
+
+/**
+ * @brief Formats the median, 95th and 99th percentiles for reports.
+ *
+ * @return std::string "p50 / p95 / p99".
+ */
+std::string Distribution::percentiles() const
+{
+    std::ostringstream out;
+    out << quantile(0.50) << " / " << quantile(0.95) << " / " << quantile(0.99);
+    return out.str();
+}
+
+/**
+ * @brief Returns the quantile sketch behind the summary.
+ *
+ * @return const QuantileSketch& The sketch.
+ */
+const QuantileSketch& Distribution::get_Sketch() const
+{
+    return sketch;
+}
\ No newline at end of file
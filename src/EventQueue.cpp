@@ -0,0 +1,77 @@
+#include "EventQueue.h"
+
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Creates an empty event queue.
+ *
+ * @param resource Memory the pending events are stored in.
+ */
+EventQueue::EventQueue(pmr::memory_resource *resource):events(resource){}
+
+/**
+ * @brief Schedules an event for a vehicle.
+ *
+ * @param time Simulation time at which the event fires.
+ * @param type Kind of event.
+ * @param vehicle Index of the vehicle the event belongs to.
+ */
+void EventQueue::push(double time, EventType type, int vehicle)
+{
+    events.push_back(SimEvent{time, type, vehicle, next_Sequence++});
+    push_heap(events.begin(), events.end(), Later());
+}
+
+/**
+ * @brief Removes and returns the earliest pending event.
+ *
+ * @return SimEvent The event with the smallest timestamp.
+ */
+SimEvent EventQueue::pop()
+{
+    pop_heap(events.begin(), events.end(), Later());
+    SimEvent e = events.back();
+    events.pop_back();
+    return e;
+}
+
+/**
+ * @brief Returns the earliest pending event without removing it.
+ *
+ * @return const SimEvent& The event with the smallest timestamp.
+ */
+const SimEvent& EventQueue::top() const
+{
+    return events.front();
+}
+
+/**
+ * @brief Checks if the queue has no pending events.
+ *
+ * @return true if empty, false otherwise.
+ */
+bool EventQueue::empty() const
+{
+    return events.empty();
+}
+
+/**
+ * @brief Returns the number of pending events.
+ *
+ * @return size_t Count of scheduled events.
+ */
+size_t EventQueue::size() const
+{
+    return events.size();
+}
+
+/**
+ * @brief Drops all pending events and restarts the sequence counter, keeping the storage.
+ */
+void EventQueue::clear()
+{
+    events.clear();
+    next_Sequence = 0;
+}
\ No newline at end of file
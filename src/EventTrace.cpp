@@ -0,0 +1,168 @@
+#include <cstring>
+#include <algorithm>
+
+#include "EventTrace.h"
+
+using namespace std;
+
+/**
+ * @brief Computes where each column starts inside a block.
+ *
+ * @param block_Events Event slots per block.
+ * @return TraceLayout Column offsets and total block size, all 8-byte aligned where the column needs it.
+ */
+TraceLayout TraceLayout::for_Block(uint32_t block_Events)
+{
+    TraceLayout l;
+    l.time = sizeof(uint64_t);
+    l.value = l.time + block_Events * sizeof(double);
+    l.vehicle = l.value + block_Events * sizeof(double);
+    l.type = l.vehicle + block_Events * sizeof(int32_t);
+    l.kind = l.type + block_Events * sizeof(int16_t);
+    l.block_Bytes = (l.kind + block_Events * sizeof(uint8_t) + 7) & ~size_t(7);
+    return l;
+}
+
+/**
+ * @brief Writes the last block and closes the file.
+ */
+EventTrace::~EventTrace()
+{
+    close();
+}
+
+/**
+ * @brief Creates a trace file and writes its header and type names.
+ *
+ * An already open trace is closed first.
+ *
+ * @param path File to write.
+ * @param type_Names Name of each vehicle type, indexed by TypeId; longer names are cut to fit.
+ * @param block_Events Event slots per block.
+ * @return true if the file was created; false otherwise.
+ */
+bool EventTrace::open(const string &path, const vector<string> &type_Names, uint32_t block_Events)
+{
+    close();
+
+    file.open(path, ios::out | ios::binary);
+    if (!file.is_open())
+        return false;
+
+    this->block_Events = max<uint32_t>(block_Events, 1);
+    layout = TraceLayout::for_Block(this->block_Events);
+
+    TraceHeader header{};
+    memcpy(header.magic, "EVTRACE", 8);
+    header.version = 1;
+    header.block_Events = this->block_Events;
+    header.type_Count = static_cast<uint32_t>(type_Names.size());
+    header.name_Bytes = name_Bytes;
+    header.data_Offset = (sizeof(TraceHeader) + type_Names.size() * name_Bytes + 63) & ~uint64_t(63);   // Blocks start on a cache line
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const string &name : type_Names)
+    {
+        char padded[name_Bytes] = {};
+        memcpy(padded, name.data(), min<size_t>(name.size(), name_Bytes - 1));
+        file.write(padded, name_Bytes);
+    }
+    vector<char> gap(header.data_Offset - sizeof(TraceHeader) - type_Names.size() * name_Bytes, 0);
+    file.write(gap.data(), gap.size());
+
+    time.assign(this->block_Events, 0.0);
+    value.assign(this->block_Events, 0.0);
+    vehicle.assign(this->block_Events, 0);
+    type.assign(this->block_Events, 0);
+    kind.assign(this->block_Events, 0);
+    count = 0;
+    total = 0;
+    return true;
+}
+
+/**
+ * @brief Appends one event to the trace.
+ *
+ * Events must be recorded in non-decreasing time order. Nothing happens while the trace is closed.
+ *
+ * @param time Simulation time of the event.
+ * @param kind What happened.
+ * @param vehicle Fleet id of the vehicle.
+ * @param type TypeId of the vehicle.
+ * @param value Kind-specific value, see TraceKind.
+ */
+void EventTrace::record(double time, TraceKind kind, int vehicle, TypeId type, double value)
+{
+    if (!file.is_open())
+        return;
+
+    this->time[count] = time;
+    this->value[count] = value;
+    this->vehicle[count] = vehicle;
+    this->type[count] = static_cast<int16_t>(type);
+    this->kind[count] = static_cast<uint8_t>(kind);
+    total++;
+
+    if (++count == block_Events)
+        write_Block();
+}
+
+/**
+ * @brief Writes the current block column by column and starts an empty one.
+ *
+ * Unused slots of a partly filled block are written as zeros so every block has the same size.
+ */
+void EventTrace::write_Block()
+{
+    fill(time.begin() + count, time.end(), 0.0);
+    fill(value.begin() + count, value.end(), 0.0);
+    fill(vehicle.begin() + count, vehicle.end(), 0);
+    fill(type.begin() + count, type.end(), 0);
+    fill(kind.begin() + count, kind.end(), 0);
+
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(time.data()), time.size() * sizeof(double));
+    file.write(reinterpret_cast<const char*>(value.data()), value.size() * sizeof(double));
+    file.write(reinterpret_cast<const char*>(vehicle.data()), vehicle.size() * sizeof(int32_t));
+    file.write(reinterpret_cast<const char*>(type.data()), type.size() * sizeof(int16_t));
+    file.write(reinterpret_cast<const char*>(kind.data()), kind.size() * sizeof(uint8_t));
+
+    size_t padding = layout.block_Bytes - (layout.kind + block_Events * sizeof(uint8_t));
+    const char zeros[8] = {};
+    file.write(zeros, padding);
+
+    count = 0;
+}
+
+/**
+ * @brief Writes the last, partly filled block and closes the file.
+ */
+void EventTrace::close()
+{
+    if (!file.is_open())
+        return;
+
+    if (count > 0)
+        write_Block();
+    file.close();
+}
+
+/**
+ * @brief Checks whether events are being recorded.
+ *
+ * @return true if a trace file is open; false otherwise.
+ */
+bool EventTrace::is_Open() const
+{
+    return file.is_open();
+}
+
+/**
+ * @brief Returns the number of events recorded since the trace was opened.
+ *
+ * @return uint64_t Event count.
+ */
+uint64_t EventTrace::get_Count() const
+{
+    return total;
+}
\ No newline at end of file
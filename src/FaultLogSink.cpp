@@ -0,0 +1,378 @@
+#include <charconv>
+#include <chrono>
+
+#include "FaultLogSink.h"
+
+using namespace std;
+
+namespace {
+    atomic<uint64_t> next_SinkId{1};                    // Source of FaultLogSink::sink_Id values
+    thread_local uint64_t cached_Sink = 0;              // Sink the calling thread last pushed to
+    thread_local void *cached_Ring = nullptr;           // That sink's ring for the calling thread
+
+    /**
+     * @brief Appends a number the way ostream prints it with default settings.
+     *
+     * @param buffer Output text.
+     * @param value Number to print with 6 significant digits.
+     */
+    void append_Number(string &buffer, double value)
+    {
+        char digits[32];
+        to_chars_result r = to_chars(digits, digits + sizeof(digits), value, chars_format::general, 6);
+        buffer.append(digits, r.ptr);
+    }
+
+    /**
+     * @brief Appends an integer.
+     *
+     * @param buffer Output text.
+     * @param value Integer to print.
+     */
+    void append_Number(string &buffer, int value)
+    {
+        char digits[16];
+        to_chars_result r = to_chars(digits, digits + sizeof(digits), value);
+        buffer.append(digits, r.ptr);
+    }
+}
+
+/**
+ * @brief Writes out pending records and closes the file.
+ */
+FaultLogSink::~FaultLogSink()
+{
+    close();
+}
+
+/**
+ * @brief Selects the file layout.
+ *
+ * @param format Text lines or binary FaultRecords; change it only while the sink is closed.
+ */
+void FaultLogSink::set_Format(FaultLogFormat format)
+{
+    this->format = format;
+}
+
+/**
+ * @brief Selects what happens when a producer's ring is full.
+ *
+ * @param policy Block until the writer makes room, or drop the record.
+ */
+void FaultLogSink::set_Backpressure(FaultLogBackpressure policy)
+{
+    backpressure = policy;
+}
+
+/**
+ * @brief Sets the number of records each producing thread can buffer.
+ *
+ * @param records Requested ring size, rounded up to a power of two; takes effect on the next open.
+ */
+void FaultLogSink::set_Capacity(size_t records)
+{
+    size_t c = 1;
+    while (c < records)
+        c <<= 1;
+    capacity = c;
+}
+
+/**
+ * @brief Opens the log file and starts the writer thread.
+ *
+ * An already open sink is closed first.
+ *
+ * @param path File to write.
+ * @param type_Names Names printed for each TypeId in text mode.
+ * @return true if the file was opened; false otherwise.
+ */
+bool FaultLogSink::open(const string &path, const vector<string> &type_Names)
+{
+    close();
+
+    file.open(path, format == FaultLogFormat::Binary ? ios::out | ios::binary : ios::out);
+    if (!file.is_open())
+        return false;
+
+    this->type_Names = type_Names;
+    sink_Id = next_SinkId++;
+    written = 0;
+    dropped = 0;
+    wake_Requested = false;
+    stop_Requested = false;
+
+    opened.store(true, memory_order_release);
+    writer = thread(&FaultLogSink::writer_Loop, this);
+    return true;
+}
+
+/**
+ * @brief Finds the calling thread's ring, registering a new one on first use.
+ *
+ * @return Ring* Ring only the calling thread pushes to.
+ */
+FaultLogSink::Ring* FaultLogSink::ring_ForThisThread()
+{
+    if (cached_Sink == sink_Id)
+        return static_cast<Ring*>(cached_Ring);
+
+    lock_guard<mutex> lk(rings_Lock);
+    thread::id self = this_thread::get_id();
+    Ring *ring = nullptr;
+
+    for (size_t i = 0; i < ring_Owners.size() && !ring; ++i)
+    {
+        if (ring_Owners[i] == self)
+            ring = rings[i].get();
+    }
+    if (!ring)
+    {
+        rings.push_back(make_unique<Ring>());
+        ring_Owners.push_back(self);
+        ring = rings.back().get();
+        ring->slots.resize(capacity);
+        ring->mask = capacity - 1;
+    }
+
+    cached_Sink = sink_Id;
+    cached_Ring = ring;
+    return ring;
+}
+
+/**
+ * @brief Logs a fault from the calling thread.
+ *
+ * Copies the record into the thread's ring; no formatting or I/O happens here. Records
+ * pushed while the sink is closed are ignored.
+ *
+ * @param record Fault to log.
+ */
+void FaultLogSink::push(const FaultRecord &record)
+{
+    if (!opened.load(memory_order_acquire))
+        return;
+
+    Ring *ring = ring_ForThisThread();
+    size_t t = ring->tail.load(memory_order_relaxed);
+
+    while (t - ring->head.load(memory_order_acquire) > ring->mask)
+    {
+        if (backpressure == FaultLogBackpressure::Drop)
+        {
+            dropped.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        {
+            lock_guard<mutex> lk(wake_Lock);
+            wake_Requested = true;
+        }
+        wake.notify_one();
+        this_thread::yield();
+    }
+
+    ring->slots[t & ring->mask] = record;
+    ring->tail.store(t + 1, memory_order_release);
+
+    if (((t + 1) & (ring->mask >> 1)) == 0)                     // Nudges the writer every half ring instead of on every push
+    {
+        {
+            lock_guard<mutex> lk(wake_Lock);
+            wake_Requested = true;
+        }
+        wake.notify_one();
+    }
+}
+
+/**
+ * @brief Formats one record as a fault_log.txt line.
+ *
+ * @param buffer Output text.
+ * @param r Record to format.
+ */
+void FaultLogSink::append_Text(string &buffer, const FaultRecord &r) const
+{
+    static const string unknown = "Unknown";
+    const string &name = (r.type >= 0 && r.type < static_cast<TypeId>(type_Names.size())) ? type_Names[r.type] : unknown;
+
+    buffer += "[FAULT] Time: ";
+    append_Number(buffer, r.time);
+    buffer += " | Vehicle Type: ";
+    buffer += name;
+    buffer += " | Fault Count: ";
+    append_Number(buffer, r.fault_Count);
+    buffer += " | Degradation: ";
+    append_Number(buffer, r.cruise_Speed);
+    buffer += '\n';
+}
+
+/**
+ * @brief Empties every ring once and writes the records out as one batch.
+ *
+ * Records are copied out before anything is formatted, so producers get their space back
+ * without waiting on the file.
+ *
+ * @param buffer Reused text buffer.
+ * @param batch Reused record buffer.
+ * @return size_t Number of records written.
+ */
+size_t FaultLogSink::drain(string &buffer, vector<FaultRecord> &batch)
+{
+    vector<Ring*> snapshot;
+    {
+        lock_guard<mutex> lk(rings_Lock);
+        for (const unique_ptr<Ring> &r : rings)
+            snapshot.push_back(r.get());
+    }
+
+    batch.clear();
+    for (Ring *ring : snapshot)
+    {
+        size_t h = ring->head.load(memory_order_relaxed);
+        size_t t = ring->tail.load(memory_order_acquire);
+
+        for (size_t i = h; i != t; ++i)
+            batch.push_back(ring->slots[i & ring->mask]);
+        ring->head.store(t, memory_order_release);
+    }
+
+    if (batch.empty())
+        return 0;
+
+    if (format == FaultLogFormat::Binary)
+    {
+        file.write(reinterpret_cast<const char*>(batch.data()), batch.size() * sizeof(FaultRecord));
+    }
+    else
+    {
+        buffer.clear();
+        for (const FaultRecord &r : batch)
+            append_Text(buffer, r);
+        file.write(buffer.data(), buffer.size());
+    }
+    file.flush();
+
+    return batch.size();
+}
+
+/**
+ * @brief Body of the writer thread.
+ *
+ * Drains the rings whenever a producer or flush asks for it, and at least every few
+ * milliseconds otherwise. On close it keeps draining until nothing is left.
+ */
+void FaultLogSink::writer_Loop()
+{
+    string buffer;
+    vector<FaultRecord> batch;
+
+    while (true)
+    {
+        bool stopping;
+        {
+            unique_lock<mutex> lk(wake_Lock);
+            wake.wait_for(lk, chrono::milliseconds(5), [this]{ return wake_Requested || stop_Requested; });
+            wake_Requested = false;
+            stopping = stop_Requested;
+        }
+
+        size_t n;
+        do
+        {
+            n = drain(buffer, batch);
+            if (n > 0)
+            {
+                lock_guard<mutex> lk(wake_Lock);
+                written += n;
+            }
+        } while (stopping && n > 0);
+        drained.notify_all();
+
+        if (stopping)
+            return;
+    }
+}
+
+/**
+ * @brief Blocks until every record pushed so far is in the file.
+ */
+void FaultLogSink::flush()
+{
+    if (!opened.load(memory_order_acquire))
+        return;
+
+    uint64_t target = 0;
+    {
+        lock_guard<mutex> lk(rings_Lock);
+        for (const unique_ptr<Ring> &r : rings)
+            target += r->tail.load(memory_order_acquire);
+    }
+
+    unique_lock<mutex> lk(wake_Lock);
+    wake_Requested = true;
+    wake.notify_one();
+    drained.wait(lk, [&]{ return written >= target; });
+}
+
+/**
+ * @brief Writes out pending records, stops the writer and closes the file.
+ *
+ * Producers must have stopped pushing before the sink is closed.
+ */
+void FaultLogSink::close()
+{
+    if (!opened.exchange(false))
+        return;
+
+    {
+        lock_guard<mutex> lk(wake_Lock);
+        stop_Requested = true;
+    }
+    wake.notify_one();
+    writer.join();
+
+    file.close();
+    rings.clear();
+    ring_Owners.clear();
+}
+
+/**
+ * @brief Checks whether the sink accepts records.
+ *
+ * @return true if a file is open; false otherwise.
+ */
+bool FaultLogSink::is_Open() const
+{
+    return opened.load(memory_order_acquire);
+}
+
+/**
+ * @brief Returns the number of records discarded because a ring was full.
+ *
+ * @return uint64_t Dropped records since the last open.
+ */
+uint64_t FaultLogSink::get_Dropped() const
+{
+    return dropped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of records written to the file.
+ *
+ * @return uint64_t Written records since the last open.
+ */
+uint64_t FaultLogSink::get_Written()
+{
+    lock_guard<mutex> lk(wake_Lock);
+    return written;
+}
+
+/**
+ * @brief Returns the file layout.
+ *
+ * @return FaultLogFormat Text or binary.
+ */
+FaultLogFormat FaultLogSink::get_Format() const
+{
+    return format;
+}
\ No newline at end of file
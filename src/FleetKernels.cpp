@@ -0,0 +1,317 @@
+#include "FleetKernels.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+/**
+ * @brief Flies a single vehicle with the branch-free formulation shared by both paths.
+ */
+inline void fly_One(double &battery, double speed, double energy, int passengers,
+                    double &session_Time, double &session_Distance, int &session_PassengerMiles, double time_increment)
+{
+    double distance = speed * time_increment;               // distance = speed * time
+    double battery_used = distance * energy;
+
+    bool active = battery > 0.0;                            // Depleted vehicles stay grounded
+    bool full = battery >= battery_used;                    // Otherwise only a partial flight is possible
+
+    double maxDistance = battery / energy;
+    double flight_Distance = full ? distance : maxDistance;
+    double flight_Time = full ? time_increment : maxDistance / speed;
+    double remaining = full ? battery - battery_used : 0.0;
+
+    battery = active ? remaining : battery;
+    session_Time += active ? flight_Time : 0.0;
+    session_Distance += active ? flight_Distance : 0.0;
+    session_PassengerMiles += active ? static_cast<int>(passengers * flight_Distance) : 0;
+}
+
+/**
+ * @brief Charges a single vehicle with the branch-free formulation shared by both paths.
+ */
+inline void charge_One(double &battery, double rate, double capacity, double &charging_Time, double time_increment)
+{
+    double battery_added = rate * time_increment;
+    double battery_atArrival = battery;
+
+    battery = min(battery + battery_added, capacity);      // Caps battery level at maximum
+
+    // Charging time only counts the part of the step before the battery was full
+    charging_Time += battery_added > 1e-6 ? time_increment * ((battery - battery_atArrival) / battery_added) : 0.0;
+}
+
+/**
+ * @brief Per-vehicle type parameters read from the fleet arrays.
+ */
+struct ArrayParams{
+    const double *energy;           // Energy use per mile
+    const int *passengers;          // Passenger counts
+    const double *rate;             // Charge rates
+    const double *capacity;         // Battery capacities
+
+    double energy_At(size_t i) const { return energy[i]; }
+    int passengers_At(size_t i) const { return passengers[i]; }
+    double rate_At(size_t i) const { return rate[i]; }
+    double capacity_At(size_t i) const { return capacity[i]; }
+#if defined(__AVX2__)
+    __m256d energy4(size_t i) const { return _mm256_loadu_pd(energy + i); }
+    __m128i passengers4(size_t i) const { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(passengers + i)); }
+    __m256d rate4(size_t i) const { return _mm256_loadu_pd(rate + i); }
+    __m256d capacity4(size_t i) const { return _mm256_loadu_pd(capacity + i); }
+#endif
+};
+
+/**
+ * @brief Type parameters of one certified type, known at compile time.
+ *
+ * Replaces every per-vehicle parameter load with a constant, so the kernels stream only
+ * the battery, speed and session arrays. The arithmetic is unchanged, so results are
+ * identical to those of ArrayParams.
+ *
+ * @tparam T Index into certified_Types.
+ */
+template <size_t T>
+struct CertifiedParams{
+    static constexpr TypeSpec spec = certified_Types[T];
+    static constexpr double rate = spec.charge_Rate();
+
+    double energy_At(size_t) const { return spec.energy_PerMile; }
+    int passengers_At(size_t) const { return spec.passenger_Count; }
+    double rate_At(size_t) const { return rate; }
+    double capacity_At(size_t) const { return spec.battery_Capacity; }
+#if defined(__AVX2__)
+    __m256d energy4(size_t) const { return _mm256_set1_pd(spec.energy_PerMile); }
+    __m128i passengers4(size_t) const { return _mm_set1_epi32(spec.passenger_Count); }
+    __m256d rate4(size_t) const { return _mm256_set1_pd(rate); }
+    __m256d capacity4(size_t) const { return _mm256_set1_pd(spec.battery_Capacity); }
+#endif
+};
+
+/**
+ * @brief Flies n vehicles whose type parameters come from Params.
+ */
+template <class Params>
+void fly_Batch(double *battery, const double *speed, const Params &params,
+               double *session_Time, double *session_Distance, int *session_PassengerMiles,
+               size_t n, double time_increment)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256d dt = _mm256_set1_pd(time_increment);
+    const __m256d zero = _mm256_setzero_pd();
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d b = _mm256_loadu_pd(battery + i);
+        __m256d s = _mm256_loadu_pd(speed + i);
+        __m256d e = params.energy4(i);
+
+        __m256d distance = _mm256_mul_pd(s, dt);
+        __m256d battery_used = _mm256_mul_pd(distance, e);
+
+        __m256d active = _mm256_cmp_pd(b, zero, _CMP_GT_OQ);
+        __m256d full = _mm256_cmp_pd(b, battery_used, _CMP_GE_OQ);
+
+        __m256d maxDistance = _mm256_div_pd(b, e);
+        __m256d flight_Distance = _mm256_blendv_pd(maxDistance, distance, full);
+        __m256d flight_Time = _mm256_blendv_pd(_mm256_div_pd(maxDistance, s), dt, full);
+        __m256d remaining = _mm256_and_pd(full, _mm256_sub_pd(b, battery_used));
+
+        _mm256_storeu_pd(battery + i, _mm256_blendv_pd(b, remaining, active));
+        _mm256_storeu_pd(session_Time + i, _mm256_add_pd(_mm256_loadu_pd(session_Time + i), _mm256_and_pd(active, flight_Time)));
+        _mm256_storeu_pd(session_Distance + i, _mm256_add_pd(_mm256_loadu_pd(session_Distance + i), _mm256_and_pd(active, flight_Distance)));
+
+        __m256d pm = _mm256_and_pd(active, _mm256_mul_pd(_mm256_cvtepi32_pd(params.passengers4(i)), flight_Distance));
+        __m128i *pm_Out = reinterpret_cast<__m128i*>(session_PassengerMiles + i);
+        _mm_storeu_si128(pm_Out, _mm_add_epi32(_mm_loadu_si128(pm_Out), _mm256_cvttpd_epi32(pm)));
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        fly_One(battery[i], speed[i], params.energy_At(i), params.passengers_At(i),
+                session_Time[i], session_Distance[i], session_PassengerMiles[i], time_increment);
+    }
+}
+
+/**
+ * @brief Charges n vehicles whose type parameters come from Params.
+ */
+template <class Params>
+void charge_Batch(double *battery, const Params &params, double *charging_Time, size_t n, double time_increment)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256d dt = _mm256_set1_pd(time_increment);
+    const __m256d eps = _mm256_set1_pd(1e-6);
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d b = _mm256_loadu_pd(battery + i);
+        __m256d added = _mm256_mul_pd(params.rate4(i), dt);
+        __m256d charged = _mm256_min_pd(_mm256_add_pd(b, added), params.capacity4(i));
+
+        __m256d counts = _mm256_cmp_pd(added, eps, _CMP_GT_OQ);
+        __m256d fraction = _mm256_div_pd(_mm256_sub_pd(charged, b), added);
+        __m256d time = _mm256_and_pd(counts, _mm256_mul_pd(dt, fraction));
+
+        _mm256_storeu_pd(battery + i, charged);
+        _mm256_storeu_pd(charging_Time + i, _mm256_add_pd(_mm256_loadu_pd(charging_Time + i), time));
+    }
+#endif
+
+    for (; i < n; ++i)
+    {
+        charge_One(battery[i], params.rate_At(i), params.capacity_At(i), charging_Time[i], time_increment);
+    }
+}
+
+using FlyKernel = void (*)(double*, const double*, double*, double*, int*, size_t, double);
+using ChargeKernel = void (*)(double*, double*, size_t, double);
+
+/**
+ * @brief Flight kernel of certified type T.
+ */
+template <size_t T>
+void fly_Certified(double *battery, const double *speed, double *session_Time, double *session_Distance,
+                   int *session_PassengerMiles, size_t n, double time_increment)
+{
+    fly_Batch(battery, speed, CertifiedParams<T>(), session_Time, session_Distance, session_PassengerMiles, n, time_increment);
+}
+
+/**
+ * @brief Charging kernel of certified type T.
+ */
+template <size_t T>
+void charge_Certified(double *battery, double *charging_Time, size_t n, double time_increment)
+{
+    charge_Batch(battery, CertifiedParams<T>(), charging_Time, n, time_increment);
+}
+
+/**
+ * @brief Builds the table of flight kernels, one instantiation per certified type.
+ */
+template <size_t... T>
+constexpr array<FlyKernel, sizeof...(T)> fly_Table(index_sequence<T...>)
+{
+    return {{&fly_Certified<T>...}};
+}
+
+/**
+ * @brief Builds the table of charging kernels, one instantiation per certified type.
+ */
+template <size_t... T>
+constexpr array<ChargeKernel, sizeof...(T)> charge_Table(index_sequence<T...>)
+{
+    return {{&charge_Certified<T>...}};
+}
+
+constexpr array<FlyKernel, certified_TypeCount> fly_Kernels = fly_Table(make_index_sequence<certified_TypeCount>());
+constexpr array<ChargeKernel, certified_TypeCount> charge_Kernels = charge_Table(make_index_sequence<certified_TypeCount>());
+
+}
+
+/**
+ * @brief Simulates a batch of vehicles flying for a given time increment.
+ *
+ * Equivalent to calling the per-vehicle flight logic on each vehicle: a full step if the
+ * battery covers it, a partial flight that empties the battery otherwise, and nothing for
+ * vehicles whose battery is already empty.
+ *
+ * @param battery Battery levels (kWh), updated.
+ * @param speed Current cruise speeds (mph).
+ * @param energy Energy use per mile (kWh).
+ * @param passengers Passenger counts.
+ * @param session_Time Session flight times (hours), accumulated.
+ * @param session_Distance Session distances (miles), accumulated.
+ * @param session_PassengerMiles Session passenger miles, accumulated.
+ * @param n Number of vehicles in the batch.
+ * @param time_increment Time step in hours.
+ */
+void FleetKernels::fly(double *battery, const double *speed, const double *energy, const int *passengers,
+                       double *session_Time, double *session_Distance, int *session_PassengerMiles,
+                       size_t n, double time_increment)
+{
+    fly_Batch(battery, speed, ArrayParams{energy, passengers, nullptr, nullptr},
+              session_Time, session_Distance, session_PassengerMiles, n, time_increment);
+}
+
+/**
+ * @brief Simulates charging a batch of vehicles for a given time increment.
+ *
+ * @param battery Battery levels (kWh), updated.
+ * @param rate Charge rates (kWh per hour).
+ * @param capacity Battery capacities (kWh).
+ * @param charging_Time Charging times of the current session (hours), accumulated.
+ * @param n Number of vehicles in the batch.
+ * @param time_increment Time step in hours.
+ */
+void FleetKernels::charge(double *battery, const double *rate, const double *capacity,
+                          double *charging_Time, size_t n, double time_increment)
+{
+    charge_Batch(battery, ArrayParams{nullptr, nullptr, rate, capacity}, charging_Time, n, time_increment);
+}
+
+/**
+ * @brief Flies a batch of vehicles that all have one certified type.
+ *
+ * Gives the same results as fly() with the type's parameters in every slot, without
+ * reading the energy and passenger arrays.
+ *
+ * @param type Index into certified_Types.
+ * @param battery Battery levels (kWh), updated.
+ * @param speed Current cruise speeds (mph), which faults may have lowered.
+ * @param session_Time Session flight times (hours), accumulated.
+ * @param session_Distance Session distances (miles), accumulated.
+ * @param session_PassengerMiles Session passenger miles, accumulated.
+ * @param n Number of vehicles in the batch.
+ * @param time_increment Time step in hours.
+ */
+void FleetKernels::fly_Certified(size_t type, double *battery, const double *speed,
+                                 double *session_Time, double *session_Distance, int *session_PassengerMiles,
+                                 size_t n, double time_increment)
+{
+    fly_Kernels[type](battery, speed, session_Time, session_Distance, session_PassengerMiles, n, time_increment);
+}
+
+/**
+ * @brief Charges a batch of vehicles that all have one certified type.
+ *
+ * Gives the same results as charge() with the type's rate and capacity in every slot,
+ * without reading the rate and capacity arrays.
+ *
+ * @param type Index into certified_Types.
+ * @param battery Battery levels (kWh), updated.
+ * @param charging_Time Charging times of the current session (hours), accumulated.
+ * @param n Number of vehicles in the batch.
+ * @param time_increment Time step in hours.
+ */
+void FleetKernels::charge_Certified(size_t type, double *battery, double *charging_Time, size_t n, double time_increment)
+{
+    charge_Kernels[type](battery, charging_Time, n, time_increment);
+}
+
+/**
+ * @brief Reports whether the kernels were compiled with the AVX2 path.
+ *
+ * @return true for AVX2 builds, false for the scalar fallback.
+ */
+bool FleetKernels::simd_Enabled()
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    return false;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,508 @@
+#include <charconv>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "FleetManifest.h"
+#include "MappedFile.h"
+#include "TextFields.h"
+
+using namespace std;
+
+namespace {
+    /**
+     * @brief Converts a number to a vehicle count.
+     *
+     * @return true if the number is a non-negative integer; false otherwise.
+     */
+    bool to_Count(double value, uint64_t &out)
+    {
+        if (!(value >= 0.0) || value != floor(value) || value > 9.0e15)
+            return false;
+        out = static_cast<uint64_t>(value);
+        return true;
+    }
+
+    /**
+     * @brief Minimal in-place JSON reader covering what a manifest needs.
+     *
+     * Strings are returned as views into the text; a string holding escape sequences is
+     * skipped correctly but reported as escaped so it is never used as a name.
+     */
+    struct JsonCursor{
+        const char *p;          // Next unread character
+        const char *end;        // One past the last character
+
+        void skip_Space()
+        {
+            while (p < end && TextFields::is_Space(*p))
+                ++p;
+        }
+
+        bool peek(char c)
+        {
+            skip_Space();
+            return p < end && *p == c;
+        }
+
+        bool consume(char c)
+        {
+            if (!peek(c))
+                return false;
+            ++p;
+            return true;
+        }
+
+        bool read_String(string_view &out, bool &escaped)
+        {
+            escaped = false;
+            if (!consume('"'))
+                return false;
+
+            const char *start = p;
+            while (p < end && *p != '"')
+            {
+                if (*p == '\\')
+                {
+                    escaped = true;
+                    ++p;
+                }
+                ++p;
+            }
+            if (p >= end)
+                return false;
+
+            out = string_view(start, p - start);
+            ++p;
+            return true;
+        }
+
+        bool read_Name(string_view &out)
+        {
+            bool escaped;
+            return read_String(out, escaped) && !escaped;
+        }
+
+        bool read_Number(double &out)
+        {
+            skip_Space();
+            from_chars_result r = from_chars(p, end, out);
+            if (r.ec != errc())
+                return false;
+            p = r.ptr;
+            return true;
+        }
+
+        bool skip_Value()
+        {
+            skip_Space();
+            if (p >= end)
+                return false;
+
+            if (*p == '"')
+            {
+                string_view s;
+                bool escaped;
+                return read_String(s, escaped);
+            }
+            if (*p == '{' || *p == '[')
+            {
+                bool object = *p == '{';
+                char close = object ? '}' : ']';
+                ++p;
+                if (consume(close))
+                    return true;
+                do
+                {
+                    if (object)
+                    {
+                        string_view key;
+                        bool escaped;
+                        if (!read_String(key, escaped) || !consume(':'))
+                            return false;
+                    }
+                    if (!skip_Value())
+                        return false;
+                } while (consume(','));
+                return consume(close);
+            }
+
+            const char *start = p;                                  // Number or literal
+            while (p < end && *p != ',' && *p != '}' && *p != ']' && !TextFields::is_Space(*p))
+                ++p;
+            return p > start;
+        }
+    };
+
+    /**
+     * @brief Calls member(key) for every member of a JSON object; member must consume the value.
+     */
+    template <typename F>
+    bool for_Each_Member(JsonCursor &c, F member)
+    {
+        if (!c.consume('{'))
+            return false;
+        if (c.consume('}'))
+            return true;
+        do
+        {
+            string_view key;
+            if (!c.read_Name(key) || !c.consume(':') || !member(key))
+                return false;
+        } while (c.consume(','));
+        return c.consume('}');
+    }
+
+    /**
+     * @brief Calls element() for every element of a JSON array; element must consume the value.
+     */
+    template <typename F>
+    bool for_Each_Element(JsonCursor &c, F element)
+    {
+        if (!c.consume('['))
+            return false;
+        if (c.consume(']'))
+            return true;
+        do
+        {
+            if (!element())
+                return false;
+        } while (c.consume(','));
+        return c.consume(']');
+    }
+}
+
+/**
+ * @brief Records the first error of a parse.
+ *
+ * @param message Description of the problem.
+ * @return false, so callers can return fail(...) directly.
+ */
+bool FleetManifest::fail(const string &message)
+{
+    if (error.empty())
+        error = message;
+    return false;
+}
+
+/**
+ * @brief Maps a manifest file and parses it.
+ *
+ * @param path CSV or JSON manifest.
+ * @return true if the manifest was read completely; false otherwise, with the reason in error.
+ */
+bool FleetManifest::load(const string &path)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        types.clear();
+        composition.clear();
+        error.clear();
+        return fail("Cannot open manifest " + path);
+    }
+    return parse(string_view(file.data() ? file.data() : "", file.size()));
+}
+
+/**
+ * @brief Parses a manifest held in memory.
+ *
+ * Replaces any types and composition from a previous parse.
+ *
+ * @param text Whole manifest; JSON if the first non-blank character is '{', CSV otherwise.
+ * @return true if the manifest was read completely; false otherwise, with the reason in error.
+ */
+bool FleetManifest::parse(string_view text)
+{
+    types.clear();
+    composition.clear();
+    pending_Runs.clear();
+    error.clear();
+
+    string_view body = TextFields::trim(text);
+    bool ok = (!body.empty() && body.front() == '{') ? parse_Json(text) : parse_Csv(text);
+
+    ok = ok && resolve_Runs();
+    pending_Runs.clear();
+    if (!ok)
+    {
+        types.clear();
+        composition.clear();
+    }
+    return ok;
+}
+
+/**
+ * @brief Returns the number of vehicles the manifest describes.
+ *
+ * @return uint64_t Sum of every run.
+ */
+uint64_t FleetManifest::vehicle_Count() const
+{
+    uint64_t total = 0;
+    for (const ManifestRun &r : composition)
+        total += r.count;
+    return total;
+}
+
+/**
+ * @brief Checks a vehicle type's parameters and stores it.
+ *
+ * @return true if the type is valid and its name is new; false otherwise.
+ */
+bool FleetManifest::add_Type(string_view name, double cruiseSpeed, double battery_Capacity, double timeTo_Charge,
+                             double energy_PerMile, double passenger_Count, double fault_Probability)
+{
+    string label(name);
+
+    if (name.empty())
+        return fail("Vehicle type without a name");
+    if (!(cruiseSpeed > 0) || !(battery_Capacity > 0) || !(timeTo_Charge > 0) || !(energy_PerMile > 0))
+        return fail("Vehicle type '" + label + "' needs a positive cruise speed, battery capacity, time to charge and energy per mile");
+    if (!(passenger_Count >= 0) || passenger_Count != floor(passenger_Count) || passenger_Count > numeric_limits<int>::max())
+        return fail("Vehicle type '" + label + "' needs a whole, non-negative passenger count");
+    if (!(fault_Probability >= 0))
+        return fail("Vehicle type '" + label + "' needs a non-negative fault probability");
+
+    for (const Vehicle &v : types)
+    {
+        if (v.name == name)
+            return fail("Vehicle type '" + label + "' is defined twice");
+    }
+
+    types.emplace_back(label, cruiseSpeed, battery_Capacity, timeTo_Charge, energy_PerMile,
+                       static_cast<int>(passenger_Count), fault_Probability);
+    return true;
+}
+
+/**
+ * @brief Appends vehicles of a type, growing the previous run when it has the same type.
+ *
+ * @param name Type name as written in the manifest.
+ * @param count Number of vehicles.
+ */
+void FleetManifest::add_Run(string_view name, uint64_t count)
+{
+    if (count == 0)
+        return;
+    if (!pending_Runs.empty() && pending_Runs.back().first == name)
+        pending_Runs.back().second += count;
+    else
+        pending_Runs.emplace_back(name, count);
+}
+
+/**
+ * @brief Looks up every run's type name, now that all types are known.
+ *
+ * Vehicle ids are ints, so the fleet may hold at most INT_MAX vehicles in total.
+ *
+ * @return true if every name refers to a defined type and the fleet fits; false otherwise.
+ */
+bool FleetManifest::resolve_Runs()
+{
+    unordered_map<string_view, size_t> index;
+    for (size_t i = 0; i < types.size(); ++i)
+        index.emplace(types[i].name, i);
+
+    uint64_t total = 0;
+    for (const pair<string_view, uint64_t> &run : pending_Runs)
+    {
+        auto it = index.find(run.first);
+        if (it == index.end())
+            return fail("Unknown vehicle type '" + string(run.first) + "'");
+
+        total += run.second;                        // Each count is below 9e15, so the sum cannot wrap before the check
+        if (total > static_cast<uint64_t>(numeric_limits<int>::max()))
+            return fail("The fleet has more than " + to_string(numeric_limits<int>::max()) + " vehicles");
+
+        if (!composition.empty() && composition.back().type == it->second)
+            composition.back().count += run.second;
+        else
+            composition.push_back(ManifestRun{it->second, run.second});
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a CSV manifest line by line.
+ *
+ * Fields may be wrapped in double quotes to hold commas.
+ *
+ * @param text Whole manifest.
+ * @return true on success; false otherwise.
+ */
+bool FleetManifest::parse_Csv(string_view text)
+{
+    const char *p = text.data();
+    const char *end = p + text.size();
+    size_t line_No = 0;
+
+    while (p < end)
+    {
+        const char *newline = static_cast<const char*>(memchr(p, '\n', end - p));
+        const char *line_End = newline ? newline : end;
+        string_view line = TextFields::trim(string_view(p, line_End - p));
+        p = newline ? newline + 1 : end;
+        ++line_No;
+
+        if (line.empty() || line.front() == '#')
+            continue;
+
+        string_view field[9];
+        size_t n = 0;
+        const char *f = line.data();
+        const char *line_Stop = line.data() + line.size();
+        while (true)
+        {
+            const char *start = f;
+            while (f < line_Stop && TextFields::is_Space(*f))
+                ++f;
+            if (f < line_Stop && *f == '"')
+            {
+                const char *close = static_cast<const char*>(memchr(f + 1, '"', line_Stop - f - 1));
+                if (!close)
+                    return fail("Line " + to_string(line_No) + ": unterminated quote");
+                f = close + 1;
+            }
+            while (f < line_Stop && *f != ',')
+                ++f;
+
+            if (n == 9)
+                return fail("Line " + to_string(line_No) + ": too many fields");
+            string_view value = TextFields::trim(string_view(start, f - start));
+            if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                value = value.substr(1, value.size() - 2);
+            field[n++] = value;
+
+            if (f >= line_Stop)
+                break;
+            ++f;                                                            // Skips the comma
+        }
+
+        string_view kind = field[0];
+        double number[6];
+
+        if (kind == "type")
+        {
+            if (n != 8)
+                return fail("Line " + to_string(line_No) + ": a type needs a name and 6 parameters");
+            for (size_t i = 0; i < 6; ++i)
+            {
+                if (!TextFields::to_Number(field[i + 2], number[i]))
+                    return fail("Line " + to_string(line_No) + ": '" + string(field[i + 2]) + "' is not a number");
+            }
+            if (!add_Type(field[1], number[0], number[1], number[2], number[3], number[4], number[5]))
+            {
+                error = "Line " + to_string(line_No) + ": " + error;
+                return false;
+            }
+        }
+        else if (kind == "fleet")
+        {
+            uint64_t count;
+            if (n != 3 || !TextFields::to_Number(field[2], number[0]) || !to_Count(number[0], count))
+                return fail("Line " + to_string(line_No) + ": a fleet row needs a type name and a whole vehicle count");
+            add_Run(field[1], count);
+        }
+        else if (kind == "vehicle")
+        {
+            if (n != 2)
+                return fail("Line " + to_string(line_No) + ": a vehicle row needs exactly a type name");
+            add_Run(field[1], 1);
+        }
+        else
+        {
+            return fail("Line " + to_string(line_No) + ": unknown record '" + string(kind) + "'");
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Parses a JSON manifest.
+ *
+ * Unknown keys are skipped so manifests can carry extra metadata.
+ *
+ * @param text Whole manifest.
+ * @return true on success; false otherwise.
+ */
+bool FleetManifest::parse_Json(string_view text)
+{
+    JsonCursor c{text.data(), text.data() + text.size()};
+
+    auto parse_Type = [&]() {
+        string_view name;
+        double param[6];
+        for (double &x : param)
+            x = numeric_limits<double>::quiet_NaN();                       // Missing fields fail validation
+
+        static const char *keys[6] = {"cruise_speed", "battery_capacity", "time_to_charge",
+                                      "energy_per_mile", "passenger_count", "fault_probability"};
+        bool members = for_Each_Member(c, [&](string_view key) {
+            if (key == "name")
+                return c.read_Name(name);
+            for (size_t i = 0; i < 6; ++i)
+            {
+                if (key == keys[i])
+                    return c.read_Number(param[i]);
+            }
+            return c.skip_Value();
+        });
+        return members && add_Type(name, param[0], param[1], param[2], param[3], param[4], param[5]);
+    };
+
+    auto parse_FleetEntry = [&]() {
+        string_view type;
+        double count = 1.0;
+        bool members = for_Each_Member(c, [&](string_view key) {
+            if (key == "type")
+                return c.read_Name(type);
+            if (key == "count")
+                return c.read_Number(count);
+            return c.skip_Value();
+        });
+
+        uint64_t n;
+        if (!members)
+            return false;
+        if (type.empty() || !to_Count(count, n))
+            return fail("Fleet entries need a type and a whole vehicle count");
+        add_Run(type, n);
+        return true;
+    };
+
+    auto parse_Vehicle = [&]() {
+        if (!c.peek('"'))
+            return parse_FleetEntry();
+
+        string_view type;
+        if (!c.read_Name(type))
+            return false;
+        add_Run(type, 1);
+        return true;
+    };
+
+    bool ok = for_Each_Member(c, [&](string_view key) {
+        if (key == "types")
+            return for_Each_Element(c, parse_Type);
+        if (key == "fleet")
+            return for_Each_Element(c, parse_FleetEntry);
+        if (key == "vehicles")
+            return for_Each_Element(c, parse_Vehicle);
+        return c.skip_Value();
+    });
+
+    c.skip_Space();
+    if (ok && c.p != c.end)
+        ok = false;
+
+    if (!ok && error.empty())
+    {
+        size_t line_No = 1;
+        for (const char *q = text.data(); q < c.p; ++q)
+            line_No += *q == '\n';
+        return fail("Line " + to_string(line_No) + ": malformed JSON manifest");
+    }
+    return ok;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+using namespace std;
+
+/**
+ * @brief Unmaps the file.
+ */
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+/**
+ * @brief Maps a whole file read-only.
+ *
+ * An already open file is closed first. Empty files open successfully with size() == 0.
+ *
+ * @param path File to open.
+ * @return true if the file could be read; false otherwise.
+ */
+bool MappedFile::open(const string &path)
+{
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    if (st.st_size > 0)
+    {
+        void *m = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+        madvise(m, st.st_size, MADV_SEQUENTIAL);
+        bytes = static_cast<const char*>(m);
+        length = st.st_size;
+        mapped = true;
+    }
+    ::close(fd);
+    return true;
+#else
+    ifstream in(path, ios::binary | ios::ate);
+    if (!in.is_open())
+        return false;
+
+    fallback.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(fallback.data(), fallback.size());
+    bytes = fallback.data();
+    length = fallback.size();
+    return true;
+#endif
+}
+
+/**
+ * @brief Unmaps the file and forgets its contents.
+ */
+void MappedFile::close()
+{
+#ifndef _WIN32
+    if (mapped)
+        munmap(const_cast<char*>(bytes), length);
+#endif
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+    fallback.clear();
+}
+
+/**
+ * @brief Returns the first byte of the file.
+ *
+ * @return const char* Start of the contents, nullptr if nothing is open or the file is empty.
+ */
+const char* MappedFile::data() const
+{
+    return bytes;
+}
+
+/**
+ * @brief Returns the size of the file.
+ *
+ * @return size_t Bytes available from data().
+ */
+size_t MappedFile::size() const
+{
+    return length;
+}
\ No newline at end of file
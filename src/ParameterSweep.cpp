@@ -0,0 +1,699 @@
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <algorithm>
+#include <limits>
+
+#include "ParameterSweep.h"
+#include "CounterRng.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+#include "TextFields.h"
+
+using namespace std;
+
+namespace {
+    const char *field_Names[] = {"cruise_speed", "battery_capacity", "time_to_charge",
+                                 "energy_per_mile", "passenger_count", "fault_probability"};
+
+    /**
+     * @brief Part of the scenario an axis changes.
+     */
+    enum class Target{
+        Chargers,           // Chargers at every site
+        Sites,              // Number of charging sites
+        FleetSize,          // Total vehicles
+        Mix,                // Weight of one type in the fleet
+        TimeIncrement,      // Length of a tick
+        SimTime,            // Simulated hours
+        TypeField           // One parameter of one vehicle type
+    };
+
+    /**
+     * @brief What an axis name refers to.
+     */
+    struct AxisTarget{
+        Target target = Target::Chargers;   // Part of the scenario changed
+        size_t type = 0;                    // Index into the manifest types, for Mix and TypeField
+        size_t field = 0;                   // Index into field_Names, for TypeField
+    };
+
+    /**
+     * @brief Everything a single run needs to know about its point.
+     */
+    struct Scenario{
+        FleetManifest fleet;                // Vehicle types and composition
+        vector<int> site_Chargers;          // Chargers at each site
+        double time_Increment = 0.5;        // Length of a tick in hours
+        double sim_Time = 3.0;              // Simulated hours
+
+        explicit Scenario(const FleetManifest &base) : fleet(base) {}
+    };
+
+    /**
+     * @brief Fleet-wide totals of one run.
+     */
+    struct SweepSample{
+        double passenger_Miles = 0.0;       // Passenger miles over every type
+        double flights = 0.0;               // Flights over every type
+        double flight_Hours = 0.0;          // Flight hours over every type
+        double faults = 0.0;                // Faults over every type
+        double charges = 0.0;               // Charging sessions over every type
+        double wait_Mean = 0.0;             // Mean charger queue wait
+        double wait_95 = 0.0;               // 95th percentile charger queue wait
+        bool queued = false;                // Whether any vehicle queued for a charger
+    };
+
+    /**
+     * @brief Works out which part of the scenario an axis name refers to.
+     *
+     * @param base Manifest whose types may be named.
+     * @param name Axis name.
+     * @param out Receives the target.
+     * @return true if the name is a known parameter; false otherwise.
+     */
+    bool resolve(const FleetManifest &base, const string &name, AxisTarget &out)
+    {
+        if (name == "chargers")
+            out.target = Target::Chargers;
+        else if (name == "sites")
+            out.target = Target::Sites;
+        else if (name == "fleet_size")
+            out.target = Target::FleetSize;
+        else if (name == "time_increment")
+            out.target = Target::TimeIncrement;
+        else if (name == "sim_time")
+            out.target = Target::SimTime;
+        else
+        {
+            bool mix = name.compare(0, 4, "mix.") == 0;
+            size_t dot = name.rfind('.');
+            if (dot == string::npos)
+                return false;
+
+            string type = mix ? name.substr(4) : name.substr(0, dot);
+            string field = mix ? string() : name.substr(dot + 1);
+
+            auto t = find_if(base.types.begin(), base.types.end(), [&](const Vehicle &v) { return v.name == type; });
+            if (t == base.types.end())
+                return false;
+            out.type = static_cast<size_t>(t - base.types.begin());
+
+            if (mix)
+            {
+                out.target = Target::Mix;
+                return true;
+            }
+            auto f = find(begin(field_Names), end(field_Names), field);
+            if (f == end(field_Names))
+                return false;
+            out.target = Target::TypeField;
+            out.field = static_cast<size_t>(f - begin(field_Names));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks whether a target only takes whole numbers.
+     */
+    bool is_Count(const AxisTarget &t)
+    {
+        return t.target == Target::Chargers || t.target == Target::Sites || t.target == Target::FleetSize ||
+               (t.target == Target::TypeField && string(field_Names[t.field]) == "passenger_count");
+    }
+
+    /**
+     * @brief Describes the values a target accepts, or returns nullptr if it accepts a value.
+     *
+     * Follows the manifest's rules for vehicle types; a zero fault probability is valid and
+     * means no faults. A non-positive tick or duration would never finish a run.
+     */
+    const char* reject(const AxisTarget &t, double v)
+    {
+        if (!isfinite(v))
+            return "a finite number";
+        const double count_Max = numeric_limits<int>::max();   // Counts are stored as int
+        switch (t.target)
+        {
+            case Target::Sites: return v >= 1 && v <= count_Max ? nullptr : "between 1 and INT_MAX";
+            case Target::FleetSize:
+            case Target::Chargers: return v >= 0 && v <= count_Max ? nullptr : "between 0 and INT_MAX";
+            case Target::Mix: return v >= 0 ? nullptr : "non-negative";
+            case Target::TimeIncrement:
+            case Target::SimTime: return v > 0 ? nullptr : "positive";
+            case Target::TypeField:
+            {
+                string field = field_Names[t.field];
+                if (field == "passenger_count")
+                    return v >= 0 && v <= count_Max ? nullptr : "between 0 and INT_MAX";
+                if (field == "fault_probability")
+                    return v >= 0 ? nullptr : "non-negative";
+                return v > 0 ? nullptr : "positive";
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Builds the scenario of one point from the base manifest.
+     *
+     * The fleet is rebuilt as one run per type only if the point changes its size or mix;
+     * counts are split by largest remainder so they always add up to the fleet size.
+     *
+     * @param base Scenario every point starts from.
+     * @param targets What each axis changes.
+     * @param values Value of each axis at the point.
+     * @return Scenario The point's scenario.
+     */
+    Scenario build_Scenario(const FleetManifest &base, const vector<AxisTarget> &targets, const vector<double> &values)
+    {
+        Scenario s(base);
+
+        vector<double> weight(base.types.size(), 0.0);
+        for (const ManifestRun &run : base.composition)
+        {
+            weight[run.type] += static_cast<double>(run.count);
+        }
+        double fleet_Size = static_cast<double>(base.vehicle_Count());
+        bool rebuild = false;
+        int chargers = 3;
+        int sites = 1;
+
+        for (size_t a = 0; a < targets.size(); ++a)
+        {
+            const AxisTarget &t = targets[a];
+            double v = values[a];
+            switch (t.target)
+            {
+                case Target::Chargers: chargers = max(static_cast<int>(v), 0); break;
+                case Target::Sites: sites = max(static_cast<int>(v), 1); break;
+                case Target::FleetSize: fleet_Size = max(v, 0.0); rebuild = true; break;
+                case Target::Mix: weight[t.type] = max(v, 0.0); rebuild = true; break;
+                case Target::TimeIncrement: s.time_Increment = v; break;
+                case Target::SimTime: s.sim_Time = v; break;
+                case Target::TypeField:
+                {
+                    Vehicle &type = s.fleet.types[t.type];
+                    double *fields[] = {&type.cruiseSpeed, &type.battery_Capacity, &type.timeTo_Charge,
+                                        &type.energy_PerMile, nullptr, &type.fault_Probability};
+                    if (fields[t.field])
+                        *fields[t.field] = v;
+                    else
+                        type.passenger_Count = static_cast<int>(v);
+                    break;
+                }
+            }
+        }
+        s.site_Chargers.assign(sites, chargers);
+
+        if (rebuild)
+        {
+            double total = 0.0;
+            for (double w : weight)
+            {
+                total += w;
+            }
+
+            uint64_t size = total > 0.0 ? static_cast<uint64_t>(fleet_Size) : 0;
+            vector<uint64_t> count(weight.size(), 0);
+            vector<pair<double, size_t>> remainder;
+            uint64_t assigned = 0;
+            for (size_t t = 0; t < weight.size(); ++t)
+            {
+                double exact = total > 0.0 ? size * weight[t] / total : 0.0;
+                count[t] = static_cast<uint64_t>(exact);
+                assigned += count[t];
+                remainder.push_back({count[t] - exact, t});     // Most negative first after sorting, i.e. largest remainder
+            }
+            sort(remainder.begin(), remainder.end());
+            for (size_t i = 0; assigned < size && i < remainder.size(); ++i, ++assigned)
+            {
+                ++count[remainder[i].second];
+            }
+
+            s.fleet.composition.clear();
+            for (size_t t = 0; t < count.size(); ++t)
+            {
+                if (count[t] > 0)
+                    s.fleet.composition.push_back(ManifestRun{t, count[t]});
+            }
+        }
+        return s;
+    }
+}
+
+/**
+ * @brief Constructs a sweep over variations of a base scenario.
+ *
+ * @param base Vehicle types and fleet composition every point starts from.
+ * @param threads Number of worker threads (default: one per hardware thread).
+ * @param event_Driven true to run each point with run_EventSim instead of run_Sim.
+ */
+ParameterSweep::ParameterSweep(const FleetManifest &base, size_t threads, bool event_Driven)
+    : base(base), thread_Count(threads), event_Driven(event_Driven),
+      seed((static_cast<uint64_t>(random_device{}()) << 32) | random_device{}()) {}
+
+/**
+ * @brief Records the first error and returns false.
+ */
+bool ParameterSweep::fail(const string &message)
+{
+    if (error.empty())
+        error = message;
+    return false;
+}
+
+/**
+ * @brief Checks that an axis names a known parameter and is not already swept.
+ */
+bool ParameterSweep::check_Name(const string &name)
+{
+    AxisTarget target;
+    if (!resolve(base, name, target))
+        return fail("Unknown sweep parameter '" + name + "'");
+    for (const SweepAxis &a : axes)
+    {
+        if (a.name == name)
+            return fail("Parameter '" + name + "' is swept twice");
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that every value of an axis is valid for the parameter it varies.
+ */
+bool ParameterSweep::check_Values(const string &name, const vector<double> &values)
+{
+    AxisTarget target;
+    resolve(base, name, target);
+    for (double v : values)
+    {
+        if (const char *need = reject(target, v))
+            return fail("Parameter '" + name + "' must be " + need);
+    }
+    return true;
+}
+
+/**
+ * @brief Adds an axis taking each listed value, crossed with every other axis.
+ *
+ * @param name Parameter to vary, see ParameterSweep.
+ * @param values Values it takes, at least one, each valid for the parameter.
+ * @return true if the axis was added; false otherwise, with the reason in error.
+ */
+bool ParameterSweep::add_Grid(const string &name, vector<double> values)
+{
+    if (!check_Name(name))
+        return false;
+    if (values.empty())
+        return fail("Grid axis '" + name + "' has no values");
+    if (!check_Values(name, values))
+        return false;
+
+    SweepAxis axis;
+    axis.name = name;
+    axis.values = move(values);
+    axes.push_back(move(axis));
+    return true;
+}
+
+/**
+ * @brief Adds an axis drawn from [low, high) by the Latin-hypercube sample.
+ *
+ * @param name Parameter to vary, see ParameterSweep.
+ * @param low Lower end of the range.
+ * @param high Upper end of the range, not below low; both ends must be valid for the parameter.
+ * @return true if the axis was added; false otherwise, with the reason in error.
+ */
+bool ParameterSweep::add_Range(const string &name, double low, double high)
+{
+    if (!check_Name(name))
+        return false;
+    if (!(low <= high))
+        return fail("Range axis '" + name + "' has its ends reversed");
+    if (!check_Values(name, {low, high}))
+        return false;
+
+    SweepAxis axis;
+    axis.name = name;
+    axis.low = low;
+    axis.high = high;
+    axes.push_back(move(axis));
+    return true;
+}
+
+/**
+ * @brief Sets how many Latin-hypercube points are drawn over the range axes.
+ *
+ * Has no effect on a sweep without range axes.
+ *
+ * @param count Points in the sample, capped at INT_MAX.
+ */
+void ParameterSweep::set_Samples(size_t count)
+{
+    samples = min(count, static_cast<size_t>(numeric_limits<int>::max()));
+}
+
+/**
+ * @brief Sets how many independent runs are made at every point.
+ *
+ * @param count Replications per point, at least 1.
+ */
+void ParameterSweep::set_Replications(int count)
+{
+    replications = max(count, 1);
+}
+
+/**
+ * @brief Sets the global seed of the sample and of every run.
+ *
+ * @param seed Global seed.
+ */
+void ParameterSweep::set_Seed(uint64_t seed)
+{
+    this->seed = seed;
+}
+
+/**
+ * @brief Adds the axes and settings of a CSV sweep spec.
+ *
+ * Blank lines and lines starting with # are ignored.
+ *
+ * @param text Whole spec, see ParameterSweep for the records.
+ * @return true if every record was understood; false otherwise, with the reason in error.
+ */
+bool ParameterSweep::parse(string_view text)
+{
+    error.clear();
+    size_t line_No = 0;
+
+    while (!text.empty())
+    {
+        size_t newline = text.find('\n');
+        string_view line = TextFields::trim(text.substr(0, newline));
+        text.remove_prefix(newline == string_view::npos ? text.size() : newline + 1);
+        ++line_No;
+
+        if (line.empty() || line.front() == '#')
+            continue;
+
+        vector<string_view> field;
+        while (true)
+        {
+            size_t comma = line.find(',');
+            field.push_back(TextFields::trim(line.substr(0, comma)));
+            if (comma == string_view::npos)
+                break;
+            line.remove_prefix(comma + 1);
+        }
+
+        string where = "Line " + to_string(line_No) + ": ";
+        vector<double> number;
+        for (size_t i = (field[0] == "grid" || field[0] == "range") ? 2 : 1; i < field.size(); ++i)
+        {
+            double value;
+            if (!TextFields::to_Number(field[i], value))
+                return fail(where + "'" + string(field[i]) + "' is not a number");
+            number.push_back(value);
+        }
+
+        if (field[0] == "grid" && field.size() >= 3)
+        {
+            if (!add_Grid(string(field[1]), number))
+            {
+                error = where + error;
+                return false;
+            }
+        }
+        else if (field[0] == "range" && field.size() == 4)
+        {
+            if (!add_Range(string(field[1]), number[0], number[1]))
+            {
+                error = where + error;
+                return false;
+            }
+        }
+        else if (field[0] == "samples" && number.size() == 1 && number[0] >= 0 && number[0] <= numeric_limits<int>::max())
+            set_Samples(static_cast<size_t>(number[0]));
+        else if (field[0] == "replications" && number.size() == 1 && number[0] >= 1 && number[0] <= numeric_limits<int>::max())
+            set_Replications(static_cast<int>(number[0]));
+        else
+            return fail(where + "expected grid,<parameter>,<values...>, range,<parameter>,<low>,<high>, samples,<count> or replications,<count>");
+    }
+    return true;
+}
+
+/**
+ * @brief Maps a CSV sweep spec and adds its axes and settings.
+ *
+ * @param path Spec file.
+ * @return true if the spec was read completely; false otherwise, with the reason in error.
+ */
+bool ParameterSweep::load(const string &path)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        error.clear();
+        return fail("Cannot open sweep spec " + path);
+    }
+    return parse(string_view(file.data() ? file.data() : "", file.size()));
+}
+
+/**
+ * @brief Lists the axis values of every point in the order they are run and reported.
+ *
+ * Grid combinations come in odometer order, the first grid axis changing slowest, and each
+ * is crossed with every point of the Latin-hypercube sample. The sample cuts each range
+ * into as many equal strata as there are sample points and takes one value from each
+ * stratum, pairing the strata of different axes at random; it depends only on the seed.
+ *
+ * @return std::vector<std::vector<double>> Value of each axis at each point.
+ */
+vector<vector<double>> ParameterSweep::points() const
+{
+    size_t grid = 1;
+    bool sampled = false;
+    for (const SweepAxis &a : axes)
+    {
+        if (a.values.empty())
+            sampled = true;
+        else
+            grid *= a.values.size();
+    }
+    size_t n = sampled ? samples : 1;
+
+    vector<vector<double>> hypercube(axes.size());
+    for (size_t a = 0; a < axes.size(); ++a)
+    {
+        if (!axes[a].values.empty())
+            continue;
+
+        vector<size_t> stratum(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            stratum[i] = i;
+        }
+        uint32_t stream = static_cast<uint32_t>(a);
+        for (size_t i = n; i > 1; --i)
+        {
+            double u = CounterRng::uniform(seed, sample_Replica, stream, static_cast<uint32_t>(i - 1));
+            swap(stratum[i - 1], stratum[static_cast<size_t>(u * i)]);
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            double u = CounterRng::uniform(seed, sample_Replica, stream, static_cast<uint32_t>(n + i));
+            hypercube[a].push_back(axes[a].low + (stratum[i] + u) / n * (axes[a].high - axes[a].low));
+        }
+    }
+
+    vector<vector<double>> out;
+    out.reserve(grid * n);
+    for (size_t g = 0; g < grid; ++g)
+    {
+        for (size_t s = 0; s < n; ++s)
+        {
+            vector<double> point(axes.size());
+            size_t rest = g;
+            for (size_t a = axes.size(); a-- > 0;)
+            {
+                const SweepAxis &axis = axes[a];
+                if (axis.values.empty())
+                    point[a] = hypercube[a][s];
+                else
+                {
+                    point[a] = axis.values[rest % axis.values.size()];
+                    rest /= axis.values.size();
+                }
+
+                AxisTarget target;
+                if (resolve(base, axis.name, target) && is_Count(target))
+                    point[a] = round(point[a]);
+            }
+            out.push_back(move(point));
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Runs every point x replication on the thread pool and stores the estimates.
+ *
+ * Each task owns its Simulation from construction to destruction, writes no fault log and
+ * prints no summary; the only write to shared memory is its own slot of the run totals.
+ * Totals are folded into estimates in point and replication order once every task is done.
+ */
+void ParameterSweep::run()
+{
+    vector<vector<double>> pts = points();
+
+    vector<AxisTarget> targets(axes.size());
+    for (size_t a = 0; a < axes.size(); ++a)
+    {
+        resolve(base, axes[a].name, targets[a]);
+    }
+
+    vector<Scenario> scenarios;
+    scenarios.reserve(pts.size());
+    for (const vector<double> &point : pts)
+    {
+        scenarios.push_back(build_Scenario(base, targets, point));
+    }
+
+    vector<SweepSample> totals(pts.size() * replications);
+    {
+        ThreadPool pool(thread_Count);
+        for (size_t p = 0; p < pts.size(); ++p)
+        {
+            for (int r = 0; r < replications; ++r)
+            {
+                pool.submit([this, &scenarios, &totals, p, r] {
+                    const Scenario &s = scenarios[p];
+                    Simulation sim;
+                    sim.set_FaultLogPath("");
+                    sim.set_PrintSummary(false);
+                    sim.set_Seed(seed, static_cast<uint32_t>(r));
+                    sim.set_SimTime(s.sim_Time);
+                    sim.set_TimeIncrement(s.time_Increment);
+                    sim.get_Chargers().set_Sites(s.site_Chargers);
+                    sim.vehicle_Init(s.fleet);
+
+                    if (event_Driven)
+                        sim.run_EventSim();
+                    else
+                        sim.run_Sim();
+
+                    SweepSample &out = totals[p * replications + r];
+                    Distribution wait;
+                    for (const Stats &t : sim.getStats().StatList)
+                    {
+                        out.passenger_Miles += t.total_PassengerMiles;
+                        out.flights += t.flight_count;
+                        out.flight_Hours += t.total_FlightTime;
+                        out.faults += t.total_Faults;
+                        out.charges += t.charge_count;
+                        wait.merge(t.queue_Wait);
+                    }
+                    out.queued = wait.count() > 0;
+                    if (out.queued)
+                    {
+                        out.wait_Mean = wait.mean();
+                        out.wait_95 = wait.quantile(0.95);
+                    }
+                });
+            }
+        }
+        pool.wait_Idle();
+    }
+
+    results.assign(pts.size(), SweepResult());
+    for (size_t p = 0; p < pts.size(); ++p)
+    {
+        SweepResult &res = results[p];
+        res.values = move(pts[p]);
+        for (int r = 0; r < replications; ++r)
+        {
+            const SweepSample &t = totals[p * replications + r];
+            res.passenger_Miles.add(t.passenger_Miles);
+            res.flights.add(t.flights);
+            res.flight_Hours.add(t.flight_Hours);
+            res.faults.add(t.faults);
+            res.charges.add(t.charges);
+            if (t.queued)
+            {
+                res.queue_Wait.add(t.wait_Mean);
+                res.queue_Wait95.add(t.wait_95);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the estimates at every point.
+ *
+ * @return const std::vector<SweepResult>& Estimates in point order, see points().
+ */
+const vector<SweepResult>& ParameterSweep::get_Results() const
+{
+    return results;
+}
+
+/**
+ * @brief Writes the results as one CSV table, a row per point.
+ *
+ * Each row holds the point index, the value of every axis, the replication count and the
+ * mean and 95% confidence half-width of every metric.
+ *
+ * @param out Stream to write to.
+ */
+void ParameterSweep::write_Table(ostream &out) const
+{
+    const char *metrics[] = {"passenger_miles", "flights", "flight_hours", "faults", "charges", "queue_wait", "queue_wait_p95"};
+
+    out << "point";
+    for (const SweepAxis &a : axes)
+    {
+        out << "," << a.name;
+    }
+    out << ",replications";
+    for (const char *m : metrics)
+    {
+        out << "," << m << "," << m << "_ci95";
+    }
+    out << "\n";
+
+    streamsize precision = out.precision(10);
+    for (size_t p = 0; p < results.size(); ++p)
+    {
+        const SweepResult &res = results[p];
+        out << p;
+        for (double v : res.values)
+        {
+            out << "," << v;
+        }
+        out << "," << replications;
+
+        const Estimate *estimates[] = {&res.passenger_Miles, &res.flights, &res.flight_Hours, &res.faults,
+                                       &res.charges, &res.queue_Wait, &res.queue_Wait95};
+        for (const Estimate *e : estimates)
+        {
+            out << "," << e->mean << "," << e->ci95();
+        }
+        out << "\n";
+    }
+    out.precision(precision);
+}
+
+/**
+ * @brief Writes the results table to a file.
+ *
+ * @param path File to write, replaced if it exists.
+ * @return true if the whole table was written; false otherwise.
+ */
+bool ParameterSweep::save_Table(const string &path) const
+{
+    ofstream file(path, ios::out | ios::trunc);
+    write_Table(file);
+    return file.good();
+}
\ No newline at end of file
@@ -0,0 +1,328 @@
+#include "PhaseProfiler.h"
+
+#include <iomanip>
+#include <cstdlib>
+#include <new>
+
+#if defined(EVTOL_PROFILE) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define EVTOL_PERF_EVENTS
+#endif
+
+using namespace std;
+
+namespace {
+    const char *phase_Names[] = {"Run", "Fly", "Faults", "FaultLog", "Chargers", "Trace", "Settle", "Merge", "Events"};
+    const char *counter_Names[] = {"Ticks", "Flights", "Faults", "Charge requests", "Charges", "Events"};
+
+#if defined(EVTOL_PROFILE)
+    thread_local uint64_t allocation_Count = 0;     // operator new calls made by this thread
+#endif
+
+#if defined(EVTOL_PERF_EVENTS)
+    /**
+     * @brief Cycle and cache-miss counters of one thread, opened on first use.
+     */
+    struct ThreadCounters{
+        int cycles = -1;            // perf_event file descriptor counting CPU cycles
+        int cache_Misses = -1;      // perf_event file descriptor counting cache misses
+        bool opened = false;        // Whether opening was already attempted
+
+        ~ThreadCounters()
+        {
+            if (cycles >= 0)
+                close(cycles);
+            if (cache_Misses >= 0)
+                close(cache_Misses);
+        }
+    };
+
+    thread_local ThreadCounters thread_Counters;
+
+    /**
+     * @brief Opens a user-space hardware counter for the calling thread.
+     *
+     * @return int File descriptor, or -1 if the kernel refuses (e.g. perf_event_paranoid).
+     */
+    int open_Counter(uint64_t config)
+    {
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    /**
+     * @brief Reads the calling thread's cycle and cache-miss counts.
+     *
+     * @return true if both counters could be read; false if unsupported or not permitted.
+     */
+    bool read_Hardware(uint64_t &cycles, uint64_t &cache_Misses)
+    {
+#if defined(EVTOL_PERF_EVENTS)
+        ThreadCounters &c = thread_Counters;
+        if (!c.opened)
+        {
+            c.opened = true;
+            c.cycles = open_Counter(PERF_COUNT_HW_CPU_CYCLES);
+            c.cache_Misses = open_Counter(PERF_COUNT_HW_CACHE_MISSES);
+        }
+        return c.cycles >= 0 && c.cache_Misses >= 0 &&
+               read(c.cycles, &cycles, sizeof(cycles)) == sizeof(cycles) &&
+               read(c.cache_Misses, &cache_Misses, sizeof(cache_Misses)) == sizeof(cache_Misses);
+#else
+        (void)cycles;
+        (void)cache_Misses;
+        return false;
+#endif
+    }
+}
+
+#if defined(EVTOL_PROFILE)
+/**
+ * @brief Counts every allocation of a profiling build, then allocates as the default operator new does.
+ */
+void* operator new(size_t size)
+{
+    ++allocation_Count;
+    if (size == 0)
+        size = 1;
+    while (true)
+    {
+        if (void *p = malloc(size))
+            return p;
+        new_handler handler = get_new_handler();
+        if (!handler)
+            throw bad_alloc();
+        handler();
+    }
+}
+
+/**
+ * @brief Frees memory from the counting operator new.
+ */
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+/**
+ * @brief Frees memory from the counting operator new.
+ */
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+#endif
+
+/**
+ * @brief Zeroes every timer and counter.
+ */
+void PhaseProfiler::reset()
+{
+    for (PhaseTotals &p : phases)
+    {
+        p.nanoseconds = 0;
+        p.calls = 0;
+        p.allocations = 0;
+        p.cycles = 0;
+        p.cache_Misses = 0;
+    }
+    for (atomic<uint64_t> &c : counters)
+    {
+        c = 0;
+    }
+    queue_Total = 0;
+    queue_Samples = 0;
+    queue_Peak = 0;
+    hardware_Available = false;
+}
+
+/**
+ * @brief Turns per-phase hardware counters on or off.
+ *
+ * Has an effect only in a profiling build on Linux, and only where the kernel lets the
+ * process open its own counters.
+ *
+ * @param enabled Whether phases read cycles and cache misses.
+ */
+void PhaseProfiler::set_HardwareCounters(bool enabled)
+{
+    hardware = enabled;
+}
+
+/**
+ * @brief Adds to a counter.
+ *
+ * @param counter Counter to increase.
+ * @param amount Amount to add.
+ */
+void PhaseProfiler::count(Counter counter, uint64_t amount)
+{
+    counters[static_cast<size_t>(counter)].fetch_add(amount, memory_order_relaxed);
+}
+
+/**
+ * @brief Records one sample of the charger queue depth.
+ *
+ * @param depth Vehicles waiting for a charger.
+ */
+void PhaseProfiler::sample_Queue(size_t depth)
+{
+    queue_Total.fetch_add(depth, memory_order_relaxed);
+    queue_Samples.fetch_add(1, memory_order_relaxed);
+
+    uint64_t peak = queue_Peak.load(memory_order_relaxed);
+    while (depth > peak && !queue_Peak.compare_exchange_weak(peak, depth, memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * @brief Returns the time spent in a phase.
+ *
+ * @return uint64_t Nanoseconds, summed over every thread that ran the phase.
+ */
+uint64_t PhaseProfiler::nanoseconds(Phase phase) const
+{
+    return phases[static_cast<size_t>(phase)].nanoseconds.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns how many times a phase was entered.
+ */
+uint64_t PhaseProfiler::calls(Phase phase) const
+{
+    return phases[static_cast<size_t>(phase)].calls.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the operator new calls made inside a phase.
+ */
+uint64_t PhaseProfiler::allocations(Phase phase) const
+{
+    return phases[static_cast<size_t>(phase)].allocations.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the value of a counter.
+ */
+uint64_t PhaseProfiler::value(Counter counter) const
+{
+    return counters[static_cast<size_t>(counter)].load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the mean sampled charger queue depth.
+ *
+ * @return double Mean depth, or 0 if nothing was sampled.
+ */
+double PhaseProfiler::queue_Mean() const
+{
+    uint64_t samples = queue_Samples.load(memory_order_relaxed);
+    return samples ? double(queue_Total.load(memory_order_relaxed)) / samples : 0.0;
+}
+
+/**
+ * @brief Returns the deepest sampled charger queue.
+ */
+uint64_t PhaseProfiler::queue_Max() const
+{
+    return queue_Peak.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Prints the time, calls and allocations of every phase that ran, then the counters.
+ *
+ * Shares are relative to the Run phase. Cycle and cache-miss columns appear only when
+ * hardware counters were read.
+ *
+ * @param out Stream to print to.
+ */
+void PhaseProfiler::print(ostream &out) const
+{
+    double run = double(nanoseconds(Phase::Run));
+
+    out << "\nProfile:\n";
+    out << left << setw(12) << "Phase" << right << setw(12) << "Time(ms)" << setw(9) << "Share"
+        << setw(12) << "Calls" << setw(12) << "Allocs";
+    if (hardware_Available)
+        out << setw(16) << "Cycles" << setw(14) << "Cache misses";
+    out << "\n";
+
+    for (size_t p = 0; p < static_cast<size_t>(Phase::Count); ++p)
+    {
+        const PhaseTotals &t = phases[p];
+        if (t.calls.load() == 0)
+            continue;
+
+        double ns = double(t.nanoseconds.load());
+        out << left << setw(12) << phase_Names[p] << right << fixed << setprecision(3) << setw(12) << ns / 1e6
+            << setprecision(1) << setw(8) << (run > 0 ? 100.0 * ns / run : 0.0) << "%"
+            << setw(12) << t.calls.load() << setw(12) << t.allocations.load();
+        if (hardware_Available)
+            out << setw(16) << t.cycles.load() << setw(14) << t.cache_Misses.load();
+        out << "\n";
+    }
+
+    for (size_t c = 0; c < static_cast<size_t>(Counter::Count); ++c)
+    {
+        out << (c == 0 ? "Counters: " : ", ") << counter_Names[c] << " " << counters[c].load();
+    }
+    out << "\nCharger queue: mean depth " << setprecision(2) << queue_Mean() << ", peak " << queue_Max() << "\n";
+}
+
+/**
+ * @brief Returns the operator new calls made so far by the calling thread.
+ *
+ * @return uint64_t Allocation count, always 0 unless built with EVTOL_PROFILE.
+ */
+uint64_t PhaseProfiler::thread_Allocations()
+{
+#if defined(EVTOL_PROFILE)
+    return allocation_Count;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Enters a phase: notes the time, the thread's allocation count and, if enabled, its hardware counters.
+ *
+ * @param profiler Profiler receiving the totals.
+ * @param phase Phase being timed.
+ */
+PhaseScope::PhaseScope(PhaseProfiler &profiler, Phase phase)
+    : profiler(profiler), phase(phase), allocations(PhaseProfiler::thread_Allocations())
+{
+    if (profiler.hardware && !read_Hardware(cycles, cache_Misses))
+        cycles = cache_Misses = 0;
+    start = chrono::steady_clock::now();
+}
+
+/**
+ * @brief Leaves the phase and adds what it used to the profiler.
+ */
+PhaseScope::~PhaseScope()
+{
+    uint64_t elapsed = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    PhaseProfiler::PhaseTotals &t = profiler.phases[static_cast<size_t>(phase)];
+
+    t.nanoseconds.fetch_add(elapsed, memory_order_relaxed);
+    t.calls.fetch_add(1, memory_order_relaxed);
+    t.allocations.fetch_add(PhaseProfiler::thread_Allocations() - allocations, memory_order_relaxed);
+
+    uint64_t c, m;
+    if (profiler.hardware && read_Hardware(c, m))
+    {
+        t.cycles.fetch_add(c - cycles, memory_order_relaxed);
+        t.cache_Misses.fetch_add(m - cache_Misses, memory_order_relaxed);
+        profiler.hardware_Available = true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "ReplicationRunner.h"
+#include "ThreadPool.h"
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+
+/**
+ * @brief Constructs a runner for a number of independent replications.
+ *
+ * @param replications Number of simulations to run.
+ * @param threads Number of worker threads (default: one per hardware thread).
+ * @param event_Driven true to run each replication with run_EventSim instead of run_Sim.
+ */
+ReplicationRunner::ReplicationRunner(int replications, size_t threads, bool event_Driven)
+    : replications(replications), thread_Count(threads), event_Driven(event_Driven),
+      seed((static_cast<uint64_t>(random_device{}()) << 32) | random_device{}()),
+      setup([](Simulation &sim, int) { sim.vehicle_Init(); }) {}
+
+/**
+ * @brief Sets the global seed of the replications.
+ *
+ * Replication r is seeded with (seed, r), so every replication gets the same random numbers
+ * on every run regardless of thread count or scheduling.
+ *
+ * @param seed Global seed.
+ */
+void ReplicationRunner::set_Seed(uint64_t seed)
+{
+    this->seed = seed;
+}
+
+/**
+ * @brief Replaces the setup applied to every replication before it runs.
+ *
+ * @param fn Callable receiving the replication's Simulation and its index.
+ */
+void ReplicationRunner::set_Setup(function<void(Simulation&, int)> fn)
+{
+    setup = move(fn);
+}
+
+/**
+ * @brief Runs every replication on the thread pool and stores their statistics.
+ *
+ * Each task owns its Simulation from construction to destruction; the only write to shared
+ * memory is its own slot in the results vector.
+ */
+void ReplicationRunner::run()
+{
+    results.assign(replications, Statistics());
+
+    ThreadPool pool(thread_Count);
+
+    for (int r = 0; r < replications; ++r)
+    {
+        pool.submit([this, r] {
+            Simulation sim;
+            sim.set_FaultLogPath("");
+            sim.set_PrintSummary(false);
+            sim.set_Seed(seed, static_cast<uint32_t>(r));
+
+            setup(sim, r);
+
+            if (event_Driven)
+                sim.run_EventSim();
+            else
+                sim.run_Sim();
+
+            results[r] = sim.getStats();
+        });
+    }
+
+    pool.wait_Idle();
+}
+
+/**
+ * @brief Returns the statistics of each replication.
+ *
+ * @return const std::vector<Statistics>& Statistics in replication order.
+ */
+const vector<Statistics>& ReplicationRunner::get_Results() const
+{
+    return results;
+}
+
+/**
+ * @brief Merges the replications into per-type estimates.
+ *
+ * Replications are folded in index order, so the result does not depend on which worker
+ * finished first. Per-flight and per-session averages only count replications in which
+ * the type flew or charged at all. Flight time, charge time and queue wait distributions
+ * are pooled across replications by merging their sketches.
+ *
+ * @return std::vector<ReplicationSummary> One summary per vehicle type, indexed by TypeId.
+ */
+vector<ReplicationSummary> ReplicationRunner::summarize() const
+{
+    vector<ReplicationSummary> summary;
+
+    for (const Statistics &stats : results)
+    {
+        if (summary.size() < stats.StatList.size())
+            summary.resize(stats.StatList.size());
+
+        for (size_t id = 0; id < stats.StatList.size(); ++id)
+        {
+            const Stats &s = stats.StatList[id];
+            ReplicationSummary &out = summary[id];
+
+            out.type_Name = stats.type_Names[id];
+            if (s.flight_count > 0)
+            {
+                out.avg_FlightTime.add(s.avg_FlightTime());
+                out.avg_Distance.add(s.avg_Distance());
+            }
+            if (s.charge_count > 0)
+                out.avg_ChargeTime.add(s.avg_ChargeTime());
+            out.passenger_Miles.add(s.total_PassengerMiles);
+            out.faults.add(s.total_Faults);
+            out.flight_Time.merge(s.flight_Time);
+            out.charge_Time.merge(s.charge_Time);
+            out.queue_Wait.merge(s.queue_Wait);
+        }
+    }
+    return summary;
+}
+
+/**
+ * @brief Prints the mean and 95% confidence interval of every metric for each vehicle type.
+ */
+void ReplicationRunner::print_Summary() const
+{
+    cout << "\n--- Replication Summary (" << results.size() << " replications, mean +/- 95% CI) ---\n";
+
+    for (const ReplicationSummary &s : summarize())
+    {
+        cout << "\nVehicle Type: " << s.type_Name << endl;
+        cout << "Average Flight Time per Flight = " << s.avg_FlightTime.mean << " +/- " << s.avg_FlightTime.ci95() << " hrs" << endl;
+        cout << "Average Distance per Flight    = " << s.avg_Distance.mean << " +/- " << s.avg_Distance.ci95() << " miles" << endl;
+        cout << "Average Charge Time per Session= " << s.avg_ChargeTime.mean << " +/- " << s.avg_ChargeTime.ci95() << " hrs" << endl;
+        cout << "Total Passenger Miles          = " << s.passenger_Miles.mean << " +/- " << s.passenger_Miles.ci95() << " miles" << endl;
+        cout << "Total Faults                   = " << s.faults.mean << " +/- " << s.faults.ci95() << endl;
+        cout << "Flight Time p50/p95/p99        = " << s.flight_Time.percentiles() << " hrs, pooled" << endl;
+        cout << "Charge Time p50/p95/p99        = " << s.charge_Time.percentiles() << " hrs, pooled" << endl;
+        cout << "Queue Wait p50/p95/p99         = " << s.queue_Wait.percentiles() << " hrs, pooled" << endl;
+    }
+}
\ No newline at end of file
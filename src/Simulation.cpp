@@ -1,39 +1,50 @@
 #include "Simulation.h"
-#include "Vehicle_Instance.h"
+
+#include "CounterRng.h"
+#include "CertifiedTypes.h"
 
 #include <iostream>
-#include <random>
-#include <unordered_map>
-#include <fstream>
+#include <map>
+#include <algorithm>
 
 using namespace std;
 
 /**
  * @brief Constructor for Simulation class.
  * 
- * Initializes default simulation parameters and binds the ChargerManager to the shared Statistics.
+ * Initializes default simulation parameters and binds the ChargingNetwork, a single site by default, to the shared Statistics.
+ * The fleet, the per-vehicle run state and the event queue allocate from the simulation's arena.
  */
-Simulation::Simulation():chargers(stats, 3),sim_time(3.0), current_time(0.0), time_Increment(0.5){}
+Simulation::Simulation():vehicles(arena.resource()), chargers(stats, vehicles, 3),sim_time(3.0), current_time(0.0), time_Increment(0.5),
+                         faultLog_Path("fault_log.txt"), charger_State(arena.resource()), queued_Since(arena.resource()),
+                         print_Summary(true), depleted(arena.resource()), wasCharging(arena.resource()),
+                         charge_Requests(arena.resource()), chunk_Requests(arena.resource()), events(arena.resource()),
+                         last_Update(arena.resource()){}
 
 void Simulation::vehicle_Init()
 {
-    //Hardcoding the vehicle types and its configurartions as per the given document
-    vehicle_Types.emplace_back(Vehicle("Alpha Company", 120, 320, 0.6, 1.6, 4, 0.25));
-    vehicle_Types.emplace_back(Vehicle("Bravo Company", 100, 100, 0.2, 1.5, 5, 0.10));
-    vehicle_Types.emplace_back(Vehicle("Charlie Company", 160, 220, 0.8, 2.2, 3, 0.5));
-    vehicle_Types.emplace_back(Vehicle("Delta Company", 90, 120, 0.62, 0.8, 2, 0.22));
-    vehicle_Types.emplace_back(Vehicle("Echo Company", 30, 150, 0.3, 5.8,  2, 0.61));
+    // Vehicle types and their configurations as per the given document, see CertifiedTypes.h
+    for (const TypeSpec &t : certified_Types)
+    {
+        vehicle_Types.register_Type(Vehicle(t.name, t.cruiseSpeed, t.battery_Capacity, t.timeTo_Charge,
+                                            t.energy_PerMile, t.passenger_Count, t.fault_Probability));
+    }
 
-    map<string, int> type_count;
+    for (TypeId id = 0; id < static_cast<TypeId>(vehicle_Types.size()); ++id)
+    {
+        stats.register_Type(id, vehicle_Types.get(id).name);
+    }
 
-    mt19937 gen(random_device{}());
-    uniform_int_distribution<>dist(0, vehicle_Types.size() -1);
+    map<string, int> type_count;
 
     // Initializes the 20 vehicles required for simulation
     for(int i=0; i<20; ++i)
     {
-        const Vehicle &v= vehicle_Types[dist(gen)];
-        vehicles.emplace_back(v);
+        // Composition comes from its own stream so it is reproducible from the fleet seed
+        double u = CounterRng::uniform(vehicles.seed, vehicles.replica, CounterRng::fleet_Stream, i);
+        TypeId type = static_cast<TypeId>(u * vehicle_Types.size());
+        const Vehicle &v= vehicle_Types.get(type);
+        vehicles.add(type, v);
         type_count[v.name]++;
     }
 
@@ -46,6 +57,114 @@ void Simulation::vehicle_Init()
     // cout << "............................................................." << endl;
 }
 
+/**
+ * @brief Builds vehicle types and the fleet from a parsed manifest instead of the built-in set.
+ * 
+ * Every fleet array is sized once for the whole manifest and then filled a run at a time. One manifest can
+ * be shared by many simulations, e.g. every replica of a ReplicationRunner.
+ * 
+ * @param manifest Types and composition read by FleetManifest.
+ */
+void Simulation::vehicle_Init(const FleetManifest &manifest)
+{
+    vector<TypeId> ids;
+    for (const Vehicle &v : manifest.types)
+    {
+        TypeId id = vehicle_Types.register_Type(v);
+        stats.register_Type(id, v.name);
+        ids.push_back(id);
+    }
+
+    size_t next = vehicles.size();
+    vehicles.resize(next + manifest.vehicle_Count());
+    for (const ManifestRun &run : manifest.composition)
+    {
+        TypeId type = ids[run.type];
+        vehicles.assign(next, next + run.count, type, vehicle_Types.get(type));
+        next += run.count;
+    }
+}
+
+/**
+ * @brief Makes the run reproducible.
+ * 
+ * Seeds both the fleet composition drawn by vehicle_Init and every vehicle's fault stream,
+ * so call it before vehicle_Init.
+ * 
+ * @param seed Global seed of the run.
+ * @param replica Replication id, gives replicas sharing a seed independent streams.
+ */
+void Simulation::set_Seed(uint64_t seed, uint32_t replica) {
+    vehicles.set_Seed(seed, replica);
+}
+
+/**
+ * @brief Sets the file that full runs write fault records to.
+ * 
+ * Replicas running side by side each need their own file, or none at all.
+ * 
+ * @param path File to write, or an empty string to disable fault logging.
+ */
+void Simulation::set_FaultLogPath(const string &path) {
+    faultLog_Path = path;
+}
+
+/**
+ * @brief Enables or disables the statistics summary printed at the end of a full run.
+ * 
+ * @param enabled true to print the summary, false to run silently.
+ */
+void Simulation::set_PrintSummary(bool enabled) {
+    print_Summary = enabled;
+}
+
+/**
+ * @brief Sets how many threads the per-vehicle phases of a tick may use.
+ * 
+ * The fleet is always split into the same chunks, so the statistics of a seeded run do
+ * not change with the thread count; only the order of lines in the fault log may. Traced
+ * runs stay on one thread.
+ * 
+ * @param threads Thread count; 1 runs every chunk on the calling thread.
+ */
+void Simulation::set_TickThreads(size_t threads) {
+    tick_Threads = max<size_t>(threads, 1);
+    tick_Pool.reset();
+}
+
+/**
+ * @brief Sets how long a full run simulates.
+ * 
+ * @param hours Simulation duration in hours.
+ */
+void Simulation::set_SimTime(double hours) {
+    sim_time = hours;
+}
+
+/**
+ * @brief Sets the length of a tick of the fixed-step loop.
+ * 
+ * Shorter ticks resolve flight ends and queue waits more finely at a proportional cost in
+ * run time. The event-driven engine does not use ticks.
+ * 
+ * @param hours Time increment in hours, greater than zero.
+ */
+void Simulation::set_TimeIncrement(double hours) {
+    time_Increment = hours;
+}
+
+/**
+ * @brief Sets the file that full runs write the binary event trace to.
+ * 
+ * The trace records every flight end, charger queue transition and fault, and can be
+ * queried afterwards with the evtol-trace tool.
+ * 
+ * @param path File to write, or an empty string to disable tracing.
+ */
+void Simulation::set_TracePath(const string &path) {
+    trace_Path = path;
+}
+
 /**
  * @brief Returns the total duration of the simulation.
  * 
@@ -64,6 +183,15 @@ double Simulation::get_CurrentTime() const {
     return current_time;
 }
 
+/**
+ * @brief Returns the length of one tick of the fixed-step loop.
+ * 
+ * @return double Time increment in hours.
+ */
+double Simulation::get_TimeIncrement() const {
+    return time_Increment;
+}
+
 /**
  * @brief Returns the number of vehicle instances in the simulation.
  * 
@@ -75,103 +203,614 @@ int Simulation::get_VehicleCount() const {
 }
 
 /**
- * @brief Gets a pointer to a specific vehicle instance.
+ * @brief Returns reference to the fleet state.
  * 
- * @param index Index of the desired vehicle.
- * @return VehicleInstance* Pointer to the vehicle.
+ * @return VehicleFleet& Per-vehicle arrays indexed by vehicle id.
  */
-VehicleInstance* Simulation::get_VehiclePointer(int index) {
-    if (index >= 0 && index < vehicles.size())
-        return &vehicles[index];
-
-    return nullptr;
+VehicleFleet& Simulation::get_Fleet() {
+    return vehicles;
 }
 
 /**
- * @brief Returns reference to the charger manager.
+ * @brief Returns reference to the charging network.
  * 
- * @return ChargerManager& Used to access or test queue state.
+ * @return ChargingNetwork& Used to configure sites or access and test queue state.
  */
-ChargerManager& Simulation::get_Chargers() {
+ChargingNetwork& Simulation::get_Chargers() {
     return chargers;
 }
 
 /**
- * @brief Runs a partial simulation for a specified duration.
+ * @brief Returns reference to the fault log.
  * 
- * @param duration Time in hours for which the simulation should advance.
+ * @return FaultLogSink& Used to pick the file format and backpressure policy before a run.
  */
-void Simulation::run_PartialSimulation(double duration) {
-    double end_time = current_time + duration;
-    unordered_map<VehicleInstance*, bool> wasCharging;
-    ofstream faultLogP("faultP_log.txt");               // Logging faults onto a text file
+FaultLogSink& Simulation::get_FaultLog() {
+    return fault_Log;
+}
 
-    chargers.reset();
+/**
+ * @brief Reduces a vehicle's cruise speed after a fault.
+ * 
+ * Each fault costs 2% of the current cruise speed, never dropping below half of the rated speed.
+ * 
+ * @param id Vehicle that encountered the fault.
+ */
+void Simulation::apply_FaultDegradation(int id)
+{
+    double floor = 0.5 * vehicles.cruiseSpeed[id];
+
+    vehicles.actualCruiseSpeed[id] *= 0.98;
+    if (vehicles.actualCruiseSpeed[id] < floor)
+        vehicles.actualCruiseSpeed[id] = floor;
+}
+
+/**
+ * @brief Opens the fault log for a run.
+ * 
+ * @param path File to write, or an empty string to leave fault logging off.
+ */
+void Simulation::open_FaultLog(const string &path)
+{
+    fault_Log.close();
+    if (path.empty())
+        return;
+
+    vector<string> names;
+    for (TypeId id = 0; id < static_cast<TypeId>(vehicle_Types.size()); ++id)
+    {
+        names.push_back(vehicle_Types.get(id).name);
+    }
+    fault_Log.open(path, names);
+}
+
+/**
+ * @brief Records a fault the fleet has already counted.
+ * 
+ * Updates the statistics, degrades the cruise speed and hands the record to the fault log,
+ * which formats and writes it off the simulation thread.
+ * 
+ * @param id Vehicle that encountered the fault.
+ * @param time Simulation time of the fault.
+ * @param target Statistics to count the fault in, the shared ones or a chunk's shard.
+ */
+void Simulation::log_Fault(int id, double time, Statistics &target)
+{
+    PROFILE_PHASE(profiler, Phase::FaultLog);
+    PROFILE_COUNT(profiler, Counter::Faults, 1);
 
-    while (current_time < end_time) {
-        for (auto& v : vehicles) {
-            if (!v.charge_depleted()) {
-                v.fly(time_Increment);
-
-                bool faultOccurred = v.simulate_Fault(time_Increment);
-                if (faultOccurred) {
-                    stats.log_Faults(v.vehicle_type.name);
-                    v.actualCruiseSpeed *= 0.98;                                    // If fault occurs then reduce cruise speed
-                    if (v.actualCruiseSpeed < 0.5 * v.vehicle_type.cruiseSpeed)
-                            v.actualCruiseSpeed = 0.5 * v.vehicle_type.cruiseSpeed;
-                    faultLogP << "[FAULT] Time: " << current_time                   // Outputs the fault info to the file
-                         << " | Vehicle Type: " << v.vehicle_type.name
-                         << " | Fault Count: " << v.fault_Count
-                         << " | Degradation: " << v.actualCruiseSpeed << "\n";
-                }
-
-                // Check if flight just ended
-                if (v.charge_depleted() && v.session_FlightTime >= 0.0) 
-                {
-                    v.finalize_FlightSession();
-                    stats.log_Flight(v.vehicle_type.name, v.total_flightTime, v.distanceFlown, v.vehicle_type.passenger_Count);
-
-                    chargers.charge_Request(&v);
-                    wasCharging[&v] = true; 
-                }
-            } else {
-                chargers.charge_Request(&v);
-                wasCharging[&v] = true;
+    target.log_Faults(vehicles.type_Id[id]);
+    apply_FaultDegradation(id);                                                // Reduces cruise speed if fault occurs
+    fault_Log.push(FaultRecord{time, vehicles.actualCruiseSpeed[id], vehicles.type_Id[id], id, vehicles.fault_Count[id], 0});
+    trace.record(time, TraceKind::Fault, id, vehicles.type_Id[id], vehicles.actualCruiseSpeed[id]);
+}
+
+/**
+ * @brief Opens the event trace for a run.
+ * 
+ * Does nothing unless a trace path was set.
+ */
+void Simulation::open_Trace()
+{
+    trace.close();
+    if (trace_Path.empty())
+        return;
+
+    vector<string> names;
+    for (TypeId id = 0; id < static_cast<TypeId>(vehicle_Types.size()); ++id)
+    {
+        names.push_back(vehicle_Types.get(id).name);
+    }
+    trace.open(trace_Path, names);
+
+    charger_State.assign(vehicles.size(), ChargeState::Idle);
+    queued_Since.assign(vehicles.size(), 0.0);
+}
+
+/**
+ * @brief Compares a vehicle's charger state with the one last traced and records the change.
+ * 
+ * Joining the queue records an Enqueue, taking a charger records a ChargeStart with the
+ * time spent queued, and leaving a charger records a ChargeEnd with the time spent charging.
+ * 
+ * @param id Vehicle to check.
+ * @param time Simulation time of the change.
+ */
+void Simulation::trace_ChargerState(int id, double time)
+{
+    if (!trace.is_Open())
+        return;
+
+    ChargeState state = vehicles.charge_State[id];
+    ChargeState previous = charger_State[id];
+    if (state == previous)
+        return;
+
+    TypeId type = vehicles.type_Id[id];
+    if (state == ChargeState::Queued)
+    {
+        queued_Since[id] = time;
+        trace.record(time, TraceKind::Enqueue, id, type, static_cast<double>(chargers.site(chargers.site_Of(id)).queue_Length()));
+    }
+    else if (state == ChargeState::Charging)
+    {
+        trace.record(time, TraceKind::ChargeStart, id, type, previous == ChargeState::Queued ? time - queued_Since[id] : 0.0);
+    }
+    else if (previous == ChargeState::Charging)
+    {
+        trace.record(time, TraceKind::ChargeEnd, id, type, vehicles.total_chargingTime[id]);
+    }
+    charger_State[id] = state;
+}
+
+/**
+ * @brief Flies one chunk of vehicles and handles their faults and finished flights.
+ * 
+ * Vehicles in the chunk are handled in id order. Statistics go to the chunk's shard and
+ * charge requests to the chunk's request list, so chunks can run on different threads.
+ * 
+ * @param chunk Index of the chunk of tick_Chunk vehicles.
+ */
+void Simulation::fly_Chunk(size_t chunk)
+{
+    size_t begin = chunk * tick_Chunk;
+    size_t end = min(begin + tick_Chunk, vehicles.size());
+    Statistics &shard = tick_Stats[chunk];
+    pmr::vector<int> &requests = chunk_Requests[chunk];
+    requests.clear();
+
+    {
+        PROFILE_PHASE(profiler, Phase::Fly);
+        vehicles.charge_depleted(begin, end, depleted);
+        vehicles.fly_Idle(begin, end, time_Increment);                         // Depleted, queued and charging vehicles stay grounded
+    }
+
+    PROFILE_PHASE(profiler, Phase::Faults);
+    for (size_t i = begin; i < end; ++i)
+    {
+        int id = static_cast<int>(i);
+
+        if (!depleted[i])
+        {
+            while (vehicles.simulate_Fault(id))                                // No random draw unless a fault fires
+            {
+                log_Fault(id, current_time, shard);
+            }
+
+            // Check if flight just ended
+            if (vehicles.charge_depleted(id) && vehicles.session_FlightTime[i] >= 0.0)
+            {
+                trace.record(current_time, TraceKind::FlightEnd, id, vehicles.type_Id[i], vehicles.session_FlightTime[i]);
+                shard.log_Flight(vehicles.type_Id[i], vehicles.session_FlightTime[i], vehicles.session_Distance[i], vehicles.passenger_Count[i]);
+                vehicles.finalize_FlightSession(id);                           // Logged first so statistics get this flight, not the running totals
+                PROFILE_COUNT(profiler, Counter::Flights, 1);
+                requests.push_back(id);
+                wasCharging[i] = true;
             }
         }
+        else
+        {
+            requests.push_back(id);                                            // Ensure request happens if depleted early
+            wasCharging[i] = true;
+        }
+    }
+}
 
-        chargers.charge_Update(time_Increment);
+/**
+ * @brief Logs the charging sessions that finished in one chunk of vehicles.
+ * 
+ * @param chunk Index of the chunk of tick_Chunk vehicles.
+ */
+void Simulation::settle_Chunk(size_t chunk)
+{
+    size_t begin = chunk * tick_Chunk;
+    size_t end = min(begin + tick_Chunk, vehicles.size());
+    Statistics &shard = tick_Stats[chunk];
+    PROFILE_PHASE(profiler, Phase::Settle);
 
-        for (auto &v : vehicles) {
-            if (v.charge_completed()) 
-            {
-                if (wasCharging[&v]) 
-                {
-                    stats.log_Charge(v.vehicle_type.name, v.total_chargingTime);
-                    v.total_chargingTime = 0.0;
-                    wasCharging[&v] = false;
-                }
-            } else if (!v.charge_depleted()) 
+    for (size_t i = begin; i < end; ++i)
+    {
+        int id = static_cast<int>(i);
+
+        if (vehicles.charge_completed(id))
+        {
+            if (wasCharging[i])
             {
-                wasCharging[&v] = false;  // Not yet depleted, no action
-            } else 
+                shard.log_Charge(vehicles.type_Id[i], vehicles.total_chargingTime[i]);
+                PROFILE_COUNT(profiler, Counter::Charges, 1);
+                vehicles.total_chargingTime[i] = 0.0;
+                wasCharging[i] = false;
+            }
+        }
+        else if (!vehicles.charge_depleted(id))
+        {
+            wasCharging[i] = false;  // Not yet depleted, no action
+        }
+        else
+        {
+            wasCharging[i] = true;  // Mark as actively charging
+        }
+    }
+}
+
+/**
+ * @brief Runs a per-chunk phase of the tick over every chunk of the fleet.
+ * 
+ * With more than one tick thread the chunks are split into one contiguous range per
+ * thread. Tracing writes a single ordered stream, so a traced run stays on one thread.
+ * 
+ * @param phase Member function handling one chunk.
+ */
+void Simulation::for_EachChunk(void (Simulation::*phase)(size_t))
+{
+    size_t chunks = tick_Stats.size();
+    size_t workers = trace.is_Open() ? 1 : min(tick_Threads, chunks);
+
+    if (workers <= 1)
+    {
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            (this->*phase)(c);
+        }
+        return;
+    }
+
+    if (!tick_Pool)
+        tick_Pool = make_unique<ThreadPool>(tick_Threads);
+
+    for (size_t w = 0; w < workers; ++w)
+    {
+        size_t begin = chunks * w / workers;
+        size_t end = chunks * (w + 1) / workers;
+        tick_Pool->submit([this, phase, begin, end] {
+            for (size_t c = begin; c < end; ++c)
             {
-                wasCharging[&v] = true;  // Mark as actively charging
+                (this->*phase)(c);
             }
+        });
+    }
+    tick_Pool->wait_Idle();
+}
+
+/**
+ * @brief Advances every vehicle and the chargers by one time increment.
+ * 
+ * The fleet is split into fixed chunks of tick_Chunk vehicles. In the first phase each
+ * chunk flies its vehicles away from the chargers and handles their faults and finished
+ * flights; then the charge requests of all chunks are handed to the chargers as one batch
+ * in id order and the chargers progress once for the whole tick; finally each chunk logs
+ * its finished charging sessions. Chunks log into their own Statistics shard, merged in
+ * chunk order at the end of the tick, so a run gives the same results for a given seed
+ * whether the chunk phases run on one thread or many.
+ */
+void Simulation::step_Tick()
+{
+    size_t chunks = (vehicles.size() + tick_Chunk - 1) / tick_Chunk;
+    tick_Stats.resize(chunks);
+    tick_Stats.prepare(stats);
+    chunk_Requests.resize(chunks);
+    for (size_t c = 0; c < chunks; ++c)
+    {
+        chunk_Requests[c].reserve(tick_Chunk);     // Chunks push at most one request per vehicle, so workers never allocate from the arena
+    }
+
+    PROFILE_COUNT(profiler, Counter::Ticks, 1);
+    for_EachChunk(&Simulation::fly_Chunk);
+
+    {
+        PROFILE_PHASE(profiler, Phase::Chargers);
+        charge_Requests.clear();
+        for (const pmr::vector<int> &requests : chunk_Requests)
+        {
+            charge_Requests.insert(charge_Requests.end(), requests.begin(), requests.end());
         }
+        chargers.charge_Request(charge_Requests.data(), charge_Requests.size());
+        PROFILE_COUNT(profiler, Counter::ChargeRequests, charge_Requests.size());
+        PROFILE_QUEUE(profiler, chargers.queue_Length());
+        chargers.charge_Update(time_Increment);
+    }
+
+    if (trace.is_Open())
+    {
+        PROFILE_PHASE(profiler, Phase::Trace);
+        for (size_t i = 0; i < vehicles.size(); ++i)
+        {
+            trace_ChargerState(static_cast<int>(i), current_time);
+        }
+    }
+
+    for_EachChunk(&Simulation::settle_Chunk);       // Post-charge logging
+
+    PROFILE_PHASE(profiler, Phase::Merge);
+    tick_Stats.merge_Into(stats);
+}
+
+/**
+ * @brief Prints the statistics summary, followed by the phase profile in a profiling build.
+ */
+void Simulation::print_Report()
+{
+    stats.print_Stats();
+#if defined(EVTOL_PROFILE)
+    profiler.print(cout);
+#endif
+}
+
+/**
+ * @brief Returns the phase timers and counters of the last run.
+ * 
+ * They stay at zero unless the simulator is built with -DEVTOL_PROFILE.
+ * 
+ * @return PhaseProfiler& Profiler of this simulation.
+ */
+PhaseProfiler& Simulation::get_Profiler() {
+    return profiler;
+}
+
+/**
+ * @brief Returns the arena holding the simulation's per-vehicle state.
+ * 
+ * @return const SimulationArena& Arena of this simulation, e.g. to see how much memory a fleet takes.
+ */
+const SimulationArena& Simulation::get_Arena() const {
+    return arena;
+}
+
+/**
+ * @brief Prepares the chargers and per-vehicle tick flags for a fixed-step run.
+ * 
+ * The first run clears them. Later runs, e.g. successive run_PartialSimulation calls or a run
+ * after load_Checkpoint, continue with the queues and flags where they were left, so a run
+ * split into pieces gives the same results as one long run.
+ */
+void Simulation::begin_TickRun()
+{
+    if (run_Started && depleted.size() == vehicles.size() && wasCharging.size() == vehicles.size())
+        return;
+
+    chargers.reset();
+    depleted.assign(vehicles.size(), false);
+    wasCharging.assign(vehicles.size(), false);
+    run_Started = true;
+}
+
+/**
+ * @brief Writes the complete simulation state to a checkpoint file.
+ * 
+ * The file holds the clock and time step, every vehicle type, the whole fleet including
+ * each vehicle's random stream position, every charging site's slots, queue and clock, the
+ * statistics with their distributions, and the per-vehicle tick flags. Settings such as
+ * the fault log, trace and thread counts are not saved. The file is written next to path
+ * and renamed into place once complete.
+ * 
+ * @param path Checkpoint file to write.
+ * @return true if the checkpoint was written; false otherwise.
+ */
+bool Simulation::save_Checkpoint(const string &path) const
+{
+    CheckpointWriter out;
+    save_State(out);
+    return out.save(path);
+}
+
+/**
+ * @brief Replaces the simulation state with one written by save_Checkpoint.
+ * 
+ * The file is memory-mapped and every array is copied straight out of the mapping. After
+ * a successful load, run_Sim and run_PartialSimulation continue from the saved time with
+ * the saved charger queues, so a run split by a checkpoint matches one run straight
+ * through. The event-driven engine rebuilds its charger queues from the restored
+ * batteries instead. A file that is not a checkpoint of this version leaves the simulation
+ * untouched; a damaged one leaves it with no vehicles.
+ * 
+ * @param path Checkpoint file to read.
+ * @return true if the whole state was restored; false otherwise.
+ */
+bool Simulation::load_Checkpoint(const string &path)
+{
+    CheckpointReader in;
+    return in.open(path) && load_State(in);
+}
+
+/**
+ * @brief Captures the complete simulation state in memory.
+ * 
+ * The snapshot holds the same bytes as a checkpoint file, laid out as one contiguous
+ * buffer of whole arrays, and is never modified by the simulation. Take it once after a
+ * warm-up and hand it to any number of simulations, on any threads, through restore().
+ * 
+ * @return std::vector<char> The state, in checkpoint format.
+ */
+vector<char> Simulation::snapshot() const
+{
+    CheckpointWriter out;
+    save_State(out);
+    return out.take_Image();
+}
+
+/**
+ * @brief Replaces the simulation state with a snapshot.
+ * 
+ * Each array is copied straight out of the snapshot, so restoring costs one copy of the
+ * state and never replays the run that produced it. Settings such as the fault log, trace
+ * and thread count are left as they are. Several simulations may restore from one
+ * snapshot at the same time.
+ * 
+ * @param image Snapshot returned by snapshot().
+ * @return true if the whole state was restored; false otherwise, as for load_Checkpoint.
+ */
+bool Simulation::restore(const vector<char> &image)
+{
+    CheckpointReader in;
+    return in.open(image.data(), image.size()) && load_State(in);
+}
+
+/**
+ * @brief Moves every vehicle's fault draws onto the random substream of a branch.
+ * 
+ * Branches restored from one snapshot draw identical faults until they are given different
+ * branch ids. The pending fault of every vehicle is redrawn from the new substream.
+ * 
+ * @param branch Branch id, unique among the branches of one warm state.
+ */
+void Simulation::set_Branch(uint32_t branch) {
+    vehicles.set_Branch(branch);
+}
+
+/**
+ * @brief Creates an independent simulation continuing from the current state.
+ * 
+ * The fork gets the clock, vehicle types, fleet, charger queues, statistics and tick
+ * flags of this simulation, with its fault draws moved onto the substream of branch.
+ * Forks write no fault log or trace, print no summary and tick on one thread, so many of
+ * them can run side by side; this simulation is left untouched. To fan out many branches
+ * from one warm state, fork them together so they share a single snapshot.
+ * 
+ * @param branch Branch id, unique among the forks of this state.
+ * @return std::unique_ptr<Simulation> The new branch, or nullptr if the state could not be copied.
+ */
+unique_ptr<Simulation> Simulation::fork(uint32_t branch) const
+{
+    vector<unique_ptr<Simulation>> forks = fork(branch, 1);
+    return forks.empty() ? nullptr : move(forks.front());
+}
+
+/**
+ * @brief Creates several independent simulations continuing from the current state.
+ * 
+ * The state is captured once and every fork restores from that one snapshot, so each
+ * branch costs a single copy of the state. Fork i is on the substream of branch
+ * first_Branch + i and is set up as by fork(branch).
+ * 
+ * @param first_Branch Branch id of the first fork.
+ * @param count Number of forks.
+ * @return std::vector<std::unique_ptr<Simulation>> The forks in branch order, or none if the state could not be copied.
+ */
+vector<unique_ptr<Simulation>> Simulation::fork(uint32_t first_Branch, size_t count) const
+{
+    const vector<char> image = snapshot();
+    vector<unique_ptr<Simulation>> forks;
+    forks.reserve(count);
 
+    for (size_t i = 0; i < count; ++i)
+    {
+        unique_ptr<Simulation> copy = make_unique<Simulation>();
+        copy->set_FaultLogPath("");
+        copy->set_PrintSummary(false);
+        if (!copy->restore(image))
+            return {};
+        copy->set_Branch(first_Branch + static_cast<uint32_t>(i));
+        forks.push_back(move(copy));
+    }
+    return forks;
+}
+
+/**
+ * @brief Writes the clock, vehicle types, fleet, chargers, statistics and tick flags.
+ * 
+ * @param out Checkpoint or snapshot being written.
+ */
+void Simulation::save_State(CheckpointWriter &out) const
+{
+    out.write(sim_time);
+    out.write(current_time);
+    out.write(time_Increment);
+    vehicle_Types.save(out);
+    vehicles.save(out);
+    chargers.save(out);
+    stats.save(out);
+    out.write(depleted);
+    out.write(wasCharging);
+    out.write(run_Started);
+}
+
+/**
+ * @brief Replaces the state written by save_State.
+ * 
+ * Besides its layout, the state must have a positive tick, which a run needs to finish,
+ * and vehicle types that index both the registry and the statistics.
+ * 
+ * @param in Checkpoint or snapshot whose header has been checked.
+ * @return true if the whole state was read; false if it is damaged, which leaves no vehicles.
+ */
+bool Simulation::load_State(CheckpointReader &in)
+{
+    chargers.reset();                           // Releases the current fleet's vehicles before it is replaced
+    double old_Time = sim_time, old_Current = current_time, old_Increment = time_Increment;
+
+    bool ok = in.read(sim_time) && in.read(current_time) && in.read(time_Increment) && time_Increment > 0 &&
+              vehicle_Types.load(in) && vehicles.load(in, vehicle_Types.size()) && chargers.load(in) && stats.load(in) &&
+              in.read(depleted) && in.read(wasCharging) && in.read(run_Started) && in.at_End() &&
+              stats.StatList.size() == vehicle_Types.size() &&
+              depleted.size() == vehicles.size() && wasCharging.size() == vehicles.size();
+    if (!ok)
+    {
+        sim_time = old_Time;                    // A damaged clock could keep the next run from finishing
+        current_time = old_Current;
+        time_Increment = old_Increment;
+        chargers.set_Sites(vector<int>{3});     // Drops whatever sites were read while the fleet still matches them
+        vehicles.clear();
+        depleted.clear();
+        wasCharging.clear();
+        run_Started = false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Runs a partial simulation for a specified duration.
+ * 
+ * @param duration Time in hours for which the simulation should advance.
+ */
+void Simulation::run_PartialSimulation(double duration) {
+    open_FaultLog("faultP_log.txt");                    // Logging faults onto a text file
+    advance_To(current_time + duration);
+    fault_Log.close();
+}
+
+/**
+ * @brief Advances the fixed-step loop by a number of ticks.
+ * 
+ * Meant for driving a simulation a little at a time, e.g. from the C API: nothing is opened,
+ * closed or printed, and the chargers and tick flags carry over from the previous call, so
+ * any sequence of steps ends like one run of the same length. The simulation time limit is
+ * not checked.
+ * 
+ * @param ticks Number of time increments to advance.
+ */
+void Simulation::step(size_t ticks) {
+    begin_TickRun();
+
+    for (size_t t = 0; t < ticks; ++t) {
+        step_Tick();
+        current_time += time_Increment;  // Progresses time in simulation by time step
+    }
+}
+
+/**
+ * @brief Advances the fixed-step loop until the current time reaches a target.
+ * 
+ * Like step(), does no file I/O and keeps the chargers. The clock moves in whole ticks, so
+ * it ends on the first tick boundary at or after the target.
+ * 
+ * @param time Simulation time in hours to advance to; an earlier time does nothing.
+ */
+void Simulation::advance_To(double time) {
+    begin_TickRun();
+
+    while (current_time < time) {
+        step_Tick();
         current_time += time_Increment;  // Progresses time in simulation by time step
     }
-    faultLogP.close();
 }
 
 /**
  * @brief Manually initiates a charge request for a vehicle.
  * 
- * @param v Pointer to the vehicle instance requesting charge.
+ * @param id Fleet id of the vehicle requesting charge.
  */
-void Simulation::request_ChargingForVehicle(VehicleInstance* v) {
-    chargers.charge_Request(v);
+void Simulation::request_ChargingForVehicle(int id) {
+    chargers.charge_Request(id);
 }
 
 /**
@@ -181,75 +820,193 @@ void Simulation::request_ChargingForVehicle(VehicleInstance* v) {
  */
 void Simulation::run_Sim()
 {
-    unordered_map<VehicleInstance*, bool> wasCharging;
+    profiler.reset();
+    {
+        PROFILE_PHASE(profiler, Phase::Run);
 
-    chargers.reset();
+        begin_TickRun();
+
+        open_FaultLog(faultLog_Path);               // Logs faults onto a file
+        open_Trace();
 
-    ofstream faultLog("fault_log.txt");        // Logs faults onto a text file
+        while(current_time < sim_time)
+        {
+            step_Tick();
+            current_time += time_Increment;  // Progresses time in simulation by time step
+        }
+    }
 
-    while(current_time < sim_time)
+    if (print_Summary)
+        print_Report();                 // Prints simulation statistics onto terminal
+    fault_Log.close();                   
+    trace.close();
+}
+
+/**
+ * @brief Starts or resumes a flight and schedules whichever comes first of its next fault or battery depletion.
+ * 
+ * @param index Index of the vehicle taking off.
+ * @param time Simulation time of take-off, or of the fault the flight resumes after.
+ */
+void Simulation::start_Flight(int index, double time)
+{
+    last_Update[index] = time;
+
+    double fault = time + vehicles.time_ToNextFault(index);           // Fault times carry over between flights
+    double depletion = time + vehicles.time_ToDepletion(index);
+
+    if (fault < depletion)
+        events.push(fault, EventType::Fault, index);
+    else
+        events.push(depletion, EventType::Depletion, index);
+}
+
+/**
+ * @brief Plugs a vehicle into a charger and schedules the moment it is full.
+ * 
+ * @param index Index of the vehicle that was given a charger.
+ * @param time Simulation time at which charging starts.
+ */
+void Simulation::start_Charging(int index, double time)
+{
+    last_Update[index] = time;
+    events.push(time + vehicles.time_ToFullCharge(index), EventType::ChargeComplete, index);
+}
+
+/**
+ * @brief Processes a single event from the queue.
+ * 
+ * Each vehicle has at most one pending event: a fault or depletion while flying, a charge
+ * completion while charging, and none while waiting in the queue.
+ * 
+ * @param e Event to process.
+ */
+void Simulation::handle_Event(const SimEvent &e)
+{
+    PROFILE_PHASE(profiler, Phase::Events);
+    PROFILE_COUNT(profiler, Counter::Events, 1);
+
+    int id = e.vehicle;
+    TypeId type = vehicles.type_Id[id];
+    chargers.set_Clock(e.time);                 // Queue waits are measured in event time
+
+    switch (e.type)
     {
-        for(auto &v: vehicles)
+        case EventType::Fault:
         {
-            if(!v.charge_depleted())
-            {
-                v.fly(time_Increment);
-
-                bool faultOccurred = v.simulate_Fault(time_Increment);
-                if (faultOccurred)
-                {
-                    stats.log_Faults(v.vehicle_type.name);
-                    v.actualCruiseSpeed *= 0.98;                                        // Reduces cruise speed if fault occurs
-                    if (v.actualCruiseSpeed < 0.5 * v.vehicle_type.cruiseSpeed)
-                            v.actualCruiseSpeed = 0.5 * v.vehicle_type.cruiseSpeed;
-                    faultLog  << "[FAULT] Time: " << current_time                       // Outputs fault info onto a file
-                         << " | Vehicle Type: " << v.vehicle_type.name
-                         << " | Fault Count: " << v.fault_Count
-                         << " | Degradation: " << v.actualCruiseSpeed << "\n";
-                }
-
-                if (v.charge_depleted() && v.session_FlightTime >= 0.0) 
-                {
-                    v.finalize_FlightSession();
-                    stats.log_Flight(v.vehicle_type.name, v.total_flightTime, v.distanceFlown, v.vehicle_type.passenger_Count);
-                    chargers.charge_Request(&v);
-                    wasCharging[&v] = true;
-                }
+            vehicles.fly(id, e.time - last_Update[id]);
+            vehicles.record_Fault(id);
+            log_Fault(id, e.time, stats);
 
-            }
-            else{
-                chargers.charge_Request(&v); // Ensure request happens if depleted early
-                wasCharging[&v] = true;
-            }
-            chargers.charge_Update(time_Increment);
+            start_Flight(id, e.time);                                          // Slower cruise stretches the remaining flight, so reschedule
+            break;
+        }
+
+        case EventType::Depletion:
+        {
+            vehicles.fly(id, e.time - last_Update[id]);
+            vehicles.current_Battery[id] = 0.0;                                // Absorbs rounding left over from the last fly step
+
+            stats.log_Flight(type, vehicles.session_FlightTime[id], vehicles.session_Distance[id], vehicles.passenger_Count[id]);
+            trace.record(e.time, TraceKind::FlightEnd, id, type, vehicles.session_FlightTime[id]);
+            vehicles.finalize_FlightSession(id);
+            PROFILE_COUNT(profiler, Counter::Flights, 1);
+
+            chargers.charge_Request(id);
+            PROFILE_COUNT(profiler, Counter::ChargeRequests, 1);
+            PROFILE_QUEUE(profiler, chargers.queue_Length());
+            trace_ChargerState(id, e.time);
+            if (chargers.is_Charging(id))
+                start_Charging(id, e.time);
+            break;
         }
-        
 
-        // Post-charge logging
-        for (auto &v : vehicles) {
-            if (v.charge_completed()) 
+        case EventType::ChargeComplete:
+        {
+            int promoted = chargers.charge_Release(id);                         // Charges the vehicle up to the event time
+            vehicles.current_Battery[id] = vehicles.battery_Capacity[id];
+
+            stats.log_Charge(type, vehicles.total_chargingTime[id]);
+            PROFILE_COUNT(profiler, Counter::Charges, 1);
+
+            trace_ChargerState(id, e.time);
+            vehicles.total_chargingTime[id] = 0.0;
+            if (promoted >= 0)
             {
-                if (wasCharging[&v]) 
-                {
-                    //cout << "[INFO] Vehicle fully charged: " << v.vehicle_type.name << endl;
-                    stats.log_Charge(v.vehicle_type.name, v.total_chargingTime);
-                    v.total_chargingTime = 0.0;
-                    wasCharging[&v] = false;
-                }
-            } else if (!v.charge_depleted()) 
+                trace_ChargerState(promoted, e.time);
+                start_Charging(promoted, e.time);
+            }
+
+            start_Flight(id, e.time);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Runs the full simulation with the discrete-event engine.
+ * 
+ * Instead of stepping every vehicle by time_Increment, the engine jumps straight from one
+ * event to the next (fault, battery depletion, charge completion). Flight and charge times are
+ * exact rather than rounded to the step size, and faults fire at the flight hours stored on
+ * each vehicle, the same Poisson process the fixed-step engine uses. Queued vehicles are
+ * promoted at the instant a charger is released. Runtime scales with the number of events,
+ * not sim_time / time_Increment. When the run ends, flying and charging vehicles are brought
+ * up to sim_time, so the fleet matches the clock as it does after a fixed-step run.
+ */
+void Simulation::run_EventSim()
+{
+    profiler.reset();
+    {
+        PROFILE_PHASE(profiler, Phase::Run);
+
+        chargers.reset();
+        run_Started = false;                        // The next fixed-step run starts from clean flags
+        events.clear();
+        last_Update.assign(vehicles.size(), current_time);
+        chargers.set_Clock(current_time);
+
+        open_FaultLog(faultLog_Path);               // Logs faults onto a file
+        open_Trace();
+
+        for (int i = 0; i < static_cast<int>(vehicles.size()); ++i)
+        {
+            if (vehicles.charge_depleted(i))
             {
-                wasCharging[&v] = false;  // Not yet depleted, no action
-            } else 
+                chargers.charge_Request(i);
+                trace_ChargerState(i, current_time);
+                if (chargers.is_Charging(i))
+                    start_Charging(i, current_time);
+            }
+            else
             {
-                wasCharging[&v] = true;  // Mark as actively charging
+                start_Flight(i, current_time);
             }
         }
-             
 
+        while (!events.empty() && events.top().time <= sim_time)
+        {
+            SimEvent e = events.pop();
+            current_time = e.time;
+            handle_Event(e);
+        }
 
-        current_time += time_Increment;  // Progresses time in simulation by time step
+        for (int i = 0; i < static_cast<int>(vehicles.size()); ++i)
+        {
+            if (vehicles.charge_State[i] == ChargeState::Idle && last_Update[i] < sim_time)
+            {
+                vehicles.fly(i, sim_time - last_Update[i]);                    // Flights still in the air end the run at sim_time too
+                last_Update[i] = sim_time;
+            }
+        }
+        chargers.set_Clock(sim_time);
+        chargers.sync();                                                       // So the fleet and a checkpoint of it match the clock
+
+        current_time = sim_time;
     }
 
-    stats.print_Stats();                // Prints simulation statistics onto terminal
-    faultLog.close();                   
+    if (print_Summary)
+        print_Report();                 // Prints simulation statistics onto terminal
+    fault_Log.close();
+    trace.close();
 }
\ No newline at end of file
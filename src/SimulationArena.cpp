@@ -0,0 +1,82 @@
+#include "SimulationArena.h"
+
+using namespace std;
+
+/**
+ * @brief Wraps an upstream resource with no chunks taken yet.
+ *
+ * @param upstream Resource every chunk is allocated from.
+ */
+SimulationArena::CountingResource::CountingResource(pmr::memory_resource *upstream):upstream(upstream){}
+
+void* SimulationArena::CountingResource::do_allocate(size_t size, size_t alignment)
+{
+    void *p = upstream->allocate(size, alignment);
+    blocks++;
+    bytes += size;
+    return p;
+}
+
+void SimulationArena::CountingResource::do_deallocate(void *p, size_t size, size_t alignment)
+{
+    upstream->deallocate(p, size, alignment);
+    blocks--;
+    bytes -= size;
+}
+
+bool SimulationArena::CountingResource::do_is_equal(const pmr::memory_resource &other) const noexcept
+{
+    return this == &other;
+}
+
+/**
+ * @brief Returns the number of chunks currently held.
+ */
+size_t SimulationArena::CountingResource::get_Blocks() const
+{
+    return blocks;
+}
+
+/**
+ * @brief Returns the number of bytes in the chunks currently held.
+ */
+size_t SimulationArena::CountingResource::get_Bytes() const
+{
+    return bytes;
+}
+
+/**
+ * @brief Creates an arena that takes no memory until its first allocation.
+ *
+ * @param initial_Chunk Size of the first chunk taken from upstream; a simulation with a large
+ *                      fleet can start bigger to need fewer chunks.
+ * @param upstream Resource the chunks come from, the global heap by default.
+ */
+SimulationArena::SimulationArena(size_t initial_Chunk, pmr::memory_resource *upstream)
+    :chunks(upstream), arena(initial_Chunk > 0 ? initial_Chunk : default_Chunk, &chunks), pools(&arena){}
+
+/**
+ * @brief Returns the resource a simulation's containers allocate from.
+ *
+ * Containers using it must not outlive the arena.
+ */
+pmr::memory_resource* SimulationArena::resource()
+{
+    return &pools;
+}
+
+/**
+ * @brief Returns how many chunks the arena has taken from the upstream resource.
+ */
+size_t SimulationArena::chunk_Count() const
+{
+    return chunks.get_Blocks();
+}
+
+/**
+ * @brief Returns the total size of the chunks the arena holds.
+ */
+size_t SimulationArena::reserved_Bytes() const
+{
+    return chunks.get_Bytes();
+}
\ No newline at end of file
@@ -5,46 +5,201 @@
 
 using namespace std;
 
+/**
+ * @brief Registers a vehicle type so it can be logged against by id.
+ * 
+ * The id must be the one given by the VehicleRegistry, so that both agree on the
+ * meaning of every TypeId.
+ * 
+ * @param vehicle_type Id of the vehicle type.
+ * @param name Name of the vehicle type, used when reporting.
+ */
+void Statistics::register_Type(TypeId vehicle_type, const string &name)
+{
+    if (vehicle_type >= static_cast<TypeId>(StatList.size()))
+    {
+        StatList.resize(vehicle_type + 1);
+        type_Names.resize(vehicle_type + 1);
+    }
+    type_Names[vehicle_type] = name;
+}
+
+/**
+ * @brief Looks up the id of a registered vehicle type by name.
+ * 
+ * @param name Name of the vehicle type.
+ * @return TypeId Id of the type, or -1 if it was never registered.
+ */
+TypeId Statistics::find_Type(const string &name) const
+{
+    for (size_t i = 0; i < type_Names.size(); ++i)
+    {
+        if (type_Names[i] == name)
+            return static_cast<TypeId>(i);
+    }
+    return -1;
+}
+
 /**
  * @brief Logs flight parameters for a given vehicle type.
  * 
- * @param vehicle_type Name of the vehicle type.
+ * @param vehicle_type Id of the vehicle type.
  * @param flight_time Duration of the flight in hours.
  * @param distance Distance flown during the flight in miles.
  * @param passengers Number of passengers on the flight.
  */
-void Statistics::log_Flight(const string &vehicle_type, double flight_time, double distance, int passengers)
+void Statistics::log_Flight(TypeId vehicle_type, double flight_time, double distance, int passengers)
 {
-    Stats &s = StatMap[vehicle_type];
+    Stats &s = StatList[vehicle_type];
 
     s.total_FlightTime += flight_time;
     s.total_Distance += distance;
     s.total_PassengerMiles += static_cast<int>(distance * passengers);
     s.flight_count++; 
+    s.flight_Time.add(flight_time);
 }
 
 /**
  * @brief Logs a charging session for a given vehicle type.
  * 
- * @param vehicle_type Name of the vehicle type.
+ * @param vehicle_type Id of the vehicle type.
  * @param charge_time Duration of the charging session in hours.
  */
-void Statistics::log_Charge(const string &vehicle_type, double charge_time)
+void Statistics::log_Charge(TypeId vehicle_type, double charge_time)
 {
-    Stats &s = StatMap[vehicle_type];
+    Stats &s = StatList[vehicle_type];
 
     s.total_ChargingTime += charge_time;
     s.charge_count++;
+    s.charge_Time.add(charge_time);
 }
 
 /**
  * @brief Logs a fault occurrence for a given vehicle type.
  * 
- * @param vehicle_type Name of the vehicle type.
+ * @param vehicle_type Id of the vehicle type.
+ */
+void Statistics::log_Faults(TypeId vehicle_type)
+{
+    StatList[vehicle_type].total_Faults++;
+}
+
+/**
+ * @brief Logs how long a vehicle waited in a charger queue.
+ * 
+ * Vehicles that get a charger straight away are logged with a wait of zero.
+ * 
+ * @param vehicle_type Id of the vehicle type.
+ * @param wait_time Hours between requesting a charger and being plugged in.
+ */
+void Statistics::log_Wait(TypeId vehicle_type, double wait_time)
+{
+    StatList[vehicle_type].queue_Wait.add(wait_time);
+}
+
+/**
+ * @brief Adds the totals of another Statistics to this one, type by type.
+ * 
+ * Both must use the same TypeIds; types only the other one has are added without a name.
+ * 
+ * @param other Statistics logged separately, e.g. by one charging site.
  */
-void Statistics::log_Faults(const string &vehicle_type)
+void Statistics::merge(const Statistics &other)
 {
-    StatMap[vehicle_type].total_Faults++;
+    if (other.StatList.size() > StatList.size())
+    {
+        StatList.resize(other.StatList.size());
+        type_Names.resize(other.StatList.size());
+    }
+
+    for (size_t id = 0; id < other.StatList.size(); ++id)
+    {
+        const Stats &o = other.StatList[id];
+        Stats &s = StatList[id];
+
+        s.total_FlightTime += o.total_FlightTime;
+        s.total_Distance += o.total_Distance;
+        s.total_ChargingTime += o.total_ChargingTime;
+        s.total_Faults += o.total_Faults;
+        s.total_PassengerMiles += o.total_PassengerMiles;
+        s.flight_count += o.flight_count;
+        s.charge_count += o.charge_count;
+        s.flight_Time.merge(o.flight_Time);
+        s.charge_Time.merge(o.charge_Time);
+        s.queue_Wait.merge(o.queue_Wait);
+    }
+}
+
+/**
+ * @brief Zeroes every total and distribution, keeping the registered types and their memory.
+ */
+void Statistics::clear()
+{
+    for (Stats &s : StatList)
+    {
+        s.total_FlightTime = 0.0;
+        s.total_Distance = 0.0;
+        s.total_ChargingTime = 0.0;
+        s.total_Faults = 0;
+        s.total_PassengerMiles = 0;
+        s.flight_count = 0;
+        s.charge_count = 0;
+        s.flight_Time.clear();
+        s.charge_Time.clear();
+        s.queue_Wait.clear();
+    }
+}
+
+/**
+ * @brief Writes the registered types and their totals and distributions to a checkpoint.
+ * 
+ * @param out Checkpoint being written.
+ */
+void Statistics::save(CheckpointWriter &out) const
+{
+    out.write(static_cast<uint64_t>(StatList.size()));
+    for (size_t id = 0; id < StatList.size(); ++id)
+    {
+        const Stats &s = StatList[id];
+        out.write(type_Names[id]);
+        out.write(s.total_FlightTime);
+        out.write(s.total_Distance);
+        out.write(s.total_ChargingTime);
+        out.write(s.total_Faults);
+        out.write(s.total_PassengerMiles);
+        out.write(s.flight_count);
+        out.write(s.charge_count);
+        s.flight_Time.save(out);
+        s.charge_Time.save(out);
+        s.queue_Wait.save(out);
+    }
+}
+
+/**
+ * @brief Replaces the registered types and their totals with those written by save().
+ * 
+ * @param in Checkpoint positioned at the statistics.
+ * @return true if every type was read; false otherwise.
+ */
+bool Statistics::load(CheckpointReader &in)
+{
+    uint64_t types = 0;
+    if (!in.read(types) || types > 65536)
+        return false;
+
+    StatList.assign(static_cast<size_t>(types), Stats());
+    type_Names.assign(static_cast<size_t>(types), string());
+    for (size_t id = 0; id < StatList.size(); ++id)
+    {
+        Stats &s = StatList[id];
+        bool ok = in.read(type_Names[id]) && in.read(s.total_FlightTime) && in.read(s.total_Distance) &&
+                  in.read(s.total_ChargingTime) && in.read(s.total_Faults) && in.read(s.total_PassengerMiles) &&
+                  in.read(s.flight_count) && in.read(s.charge_count) &&
+                  s.flight_Time.load(in) && s.charge_Time.load(in) && s.queue_Wait.load(in);
+        if (!ok)
+            return false;
+    }
+    return true;
 }
 
 /**
@@ -55,11 +210,11 @@ void Statistics::log_Faults(const string &vehicle_type)
  */
 int Statistics::get_ChargerCount(const std::string& type) const 
 {
-    auto it = StatMap.find(type);
+    TypeId id = find_Type(type);
 
-    if (it != StatMap.end()) 
+    if (id >= 0) 
     {
-        return it->second.charge_count;
+        return StatList[id].charge_count;
     }
     return 0;
 }
@@ -72,9 +227,9 @@ int Statistics::get_ChargerCount(const std::string& type) const
  */
 int Statistics::get_fault_Count(const std::string& type) const 
 {
-    auto it = StatMap.find(type);
+    TypeId id = find_Type(type);
 
-    if (it != StatMap.end()) return it->second.total_Faults;
+    if (id >= 0) return StatList[id].total_Faults;
     return 0;
 }
 
@@ -86,10 +241,10 @@ void Statistics::print_Stats()
 {
     cout << "\n--- Simulation Summary ---\n";
 
-    for(const auto &vehicle: StatMap)
+    for(size_t id = 0; id < StatList.size(); ++id)
     {
-        const string &type = vehicle.first;
-        const Stats &s = vehicle.second;
+        const string &type = type_Names[id];
+        const Stats &s = StatList[id];
 
         cout << "\nVehicle Type: " << type << endl;
         cout << "Average Flight Time per Flight = " << s.avg_FlightTime() << " hrs"  << endl;
@@ -97,5 +252,8 @@ void Statistics::print_Stats()
         cout << "Average Charge Time per Session= " << s.avg_ChargeTime() << " hrs" << endl;
         cout << "Total Passenger Miles          = " << s.total_PassengerMiles << " miles" << endl;
         cout << "Total Faults                   = " << s.total_Faults << endl;
+        cout << "Flight Time p50/p95/p99        = " << s.flight_Time.percentiles() << " hrs" << endl;
+        cout << "Charge Time p50/p95/p99        = " << s.charge_Time.percentiles() << " hrs" << endl;
+        cout << "Queue Wait p50/p95/p99         = " << s.queue_Wait.percentiles() << " hrs" << endl;
     }
 }
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "StatisticsShards.h"
+
+using namespace std;
+
+/**
+ * @brief Sets the number of shards.
+ *
+ * Existing shards keep their contents; new ones are empty until prepare().
+ *
+ * @param count Number of shards.
+ */
+void StatisticsShards::resize(size_t count)
+{
+    shards.resize(count);
+}
+
+/**
+ * @brief Returns the number of shards.
+ *
+ * @return size_t Shard count.
+ */
+size_t StatisticsShards::size() const
+{
+    return shards.size();
+}
+
+/**
+ * @brief Registers the types of a Statistics object in every shard that lacks them.
+ *
+ * Call before handing the shards to workers, so that logging never grows a shard.
+ *
+ * @param layout Statistics whose vehicle types the shards should mirror.
+ */
+void StatisticsShards::prepare(const Statistics &layout)
+{
+    for (Shard &s : shards)
+    {
+        for (size_t id = s.stats.StatList.size(); id < layout.StatList.size(); ++id)
+        {
+            s.stats.register_Type(static_cast<TypeId>(id), layout.type_Names[id]);
+        }
+    }
+}
+
+/**
+ * @brief Returns the shard for one unit of work.
+ *
+ * @param index Shard index, below size().
+ * @return Statistics& The shard, to be written by one thread at a time.
+ */
+Statistics& StatisticsShards::operator[](size_t index)
+{
+    return shards[index].stats;
+}
+
+/**
+ * @brief Adds every shard to a target Statistics in shard order, then clears the shards.
+ *
+ * @param target Statistics receiving the totals.
+ */
+void StatisticsShards::merge_Into(Statistics &target)
+{
+    for (Shard &s : shards)
+    {
+        target.merge(s.stats);
+        s.stats.clear();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "ThreadPool.h"
+
+using namespace std;
+
+namespace {
+    thread_local const ThreadPool *current_Pool = nullptr;     // Pool owning the calling thread, if it is a worker
+    thread_local size_t current_Worker = 0;                    // Index of the calling worker within its pool
+}
+
+/**
+ * @brief Starts the worker threads, each with its own task queue.
+ *
+ * @param threads Number of workers; at least one is always started.
+ */
+ThreadPool::ThreadPool(size_t threads)
+{
+    if (threads == 0)
+        threads = 1;
+
+    for (size_t i = 0; i < threads; ++i)
+    {
+        queues.push_back(make_unique<WorkerQueue>());
+    }
+    for (size_t i = 0; i < threads; ++i)
+    {
+        workers.emplace_back(&ThreadPool::worker_Loop, this, i);
+    }
+}
+
+/**
+ * @brief Lets the workers drain every queued task, then joins them.
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lk(state_Lock);
+        stopping = true;
+    }
+    work_Available.notify_all();
+
+    for (thread &t : workers)
+    {
+        t.join();
+    }
+}
+
+/**
+ * @brief Queues a task for execution on one of the workers.
+ *
+ * The task is counted before it is published: once it sits in a deque another worker may
+ * steal and finish it at once, and the counters must never see it finish before it was
+ * submitted, or wait_Idle could return while work is still running.
+ *
+ * @param task Callable to run.
+ */
+void ThreadPool::submit(function<void()> task)
+{
+    size_t target = (current_Pool == this) ? current_Worker : next_Queue++ % queues.size();
+
+    {
+        lock_guard<mutex> lk(state_Lock);
+        queued++;
+        pending++;
+    }
+    {
+        lock_guard<mutex> lk(queues[target]->lock);
+        queues[target]->tasks.push_back(move(task));
+    }
+    work_Available.notify_one();
+}
+
+/**
+ * @brief Blocks until every submitted task, including ones submitted by tasks, has finished.
+ */
+void ThreadPool::wait_Idle()
+{
+    unique_lock<mutex> lk(state_Lock);
+    all_Done.wait(lk, [this] { return pending == 0; });
+}
+
+/**
+ * @brief Returns the number of worker threads.
+ *
+ * @return size_t Worker count.
+ */
+size_t ThreadPool::size() const
+{
+    return workers.size();
+}
+
+/**
+ * @brief Takes the newest task from the worker's own queue, or steals the oldest task of another worker.
+ *
+ * @param self Index of the calling worker.
+ * @param task Receives the task when one was found.
+ * @return true if a task was taken, false if every queue was empty.
+ */
+bool ThreadPool::try_Pop(size_t self, function<void()> &task)
+{
+    for (size_t k = 0; k < queues.size(); ++k)
+    {
+        size_t victim = (self + k) % queues.size();
+        WorkerQueue &q = *queues[victim];
+        lock_guard<mutex> lk(q.lock);
+
+        if (q.tasks.empty())
+            continue;
+
+        if (victim == self)
+        {
+            task = move(q.tasks.back());
+            q.tasks.pop_back();
+        }
+        else
+        {
+            task = move(q.tasks.front());
+            q.tasks.pop_front();
+        }
+
+        lock_guard<mutex> state(state_Lock);
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Runs tasks until the pool is stopped and no queued work remains.
+ *
+ * @param self Index of this worker.
+ */
+void ThreadPool::worker_Loop(size_t self)
+{
+    current_Pool = this;
+    current_Worker = self;
+
+    function<void()> task;
+
+    while (true)
+    {
+        if (try_Pop(self, task))
+        {
+            task();
+            task = nullptr;
+
+            lock_guard<mutex> lk(state_Lock);
+            if (--pending == 0)
+                all_Done.notify_all();
+            continue;
+        }
+
+        unique_lock<mutex> lk(state_Lock);
+        work_Available.wait(lk, [this] { return stopping || queued > 0; });
+
+        if (stopping && queued == 0)
+            return;
+    }
+}
\ No newline at end of file
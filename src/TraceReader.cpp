@@ -0,0 +1,161 @@
+#include <cstring>
+
+#include "TraceReader.h"
+
+using namespace std;
+
+/**
+ * @brief Unmaps the file.
+ */
+TraceReader::~TraceReader()
+{
+    close();
+}
+
+/**
+ * @brief Maps a trace file and reads its header and type names.
+ *
+ * An already open file is closed first.
+ *
+ * @param path Trace file written by EventTrace.
+ * @return true if the file is a valid trace; false otherwise.
+ */
+bool TraceReader::open(const string &path)
+{
+    close();
+
+    if (file.open(path))
+    {
+        data = reinterpret_cast<const unsigned char*>(file.data());
+        length = file.size();
+    }
+
+    if (!data || length < sizeof(TraceHeader))
+    {
+        close();
+        return false;
+    }
+
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, "EVTRACE", 8) != 0 || header.version != 1 || header.block_Events == 0 ||
+        header.data_Offset > length || sizeof(TraceHeader) + uint64_t(header.type_Count) * header.name_Bytes > header.data_Offset)
+    {
+        close();
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header.type_Count; ++i)
+    {
+        const char *name = reinterpret_cast<const char*>(data + sizeof(TraceHeader) + i * header.name_Bytes);
+        type_Names.emplace_back(name, strnlen(name, header.name_Bytes));
+    }
+
+    layout = TraceLayout::for_Block(header.block_Events);
+    blocks = (length - header.data_Offset) / layout.block_Bytes;
+    events = 0;
+    if (blocks > 0)
+        events = uint64_t(blocks - 1) * header.block_Events + block(blocks - 1).count;    // Only the last block may be partly filled
+    return true;
+}
+
+/**
+ * @brief Unmaps the file and forgets its contents.
+ */
+void TraceReader::close()
+{
+    file.close();
+    data = nullptr;
+    length = 0;
+    type_Names.clear();
+    blocks = 0;
+    events = 0;
+}
+
+/**
+ * @brief Returns the number of blocks in the file.
+ *
+ * @return size_t Block count.
+ */
+size_t TraceReader::block_Count() const
+{
+    return blocks;
+}
+
+/**
+ * @brief Returns the number of events in the file.
+ *
+ * @return uint64_t Event count.
+ */
+uint64_t TraceReader::event_Count() const
+{
+    return events;
+}
+
+/**
+ * @brief Returns the columns of one block without copying them.
+ *
+ * @param index Block number, below block_Count().
+ * @return TraceBlock Pointers into the mapped file.
+ */
+TraceBlock TraceReader::block(size_t index) const
+{
+    const unsigned char *base = data + header.data_Offset + index * layout.block_Bytes;
+
+    uint64_t count;
+    memcpy(&count, base, sizeof(count));
+
+    TraceBlock b;
+    b.count = static_cast<size_t>(count < header.block_Events ? count : header.block_Events);
+    b.time = reinterpret_cast<const double*>(base + layout.time);
+    b.value = reinterpret_cast<const double*>(base + layout.value);
+    b.vehicle = reinterpret_cast<const int32_t*>(base + layout.vehicle);
+    b.type = reinterpret_cast<const int16_t*>(base + layout.type);
+    b.kind = reinterpret_cast<const uint8_t*>(base + layout.kind);
+    return b;
+}
+
+/**
+ * @brief Finds the first block whose last event is at or after a time.
+ *
+ * Only the last time of each visited block is read, so the search touches about
+ * log2(block_Count()) pages of a large file.
+ *
+ * @param time Start of the window of interest.
+ * @return size_t Block number, or block_Count() if every event is earlier.
+ */
+size_t TraceReader::find_Block(double time) const
+{
+    size_t lo = 0, hi = blocks;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        TraceBlock b = block(mid);
+        if (b.count == 0 || b.time[b.count - 1] < time)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * @brief Returns the number of vehicle types named in the file.
+ *
+ * @return size_t Type count.
+ */
+size_t TraceReader::type_Count() const
+{
+    return type_Names.size();
+}
+
+/**
+ * @brief Returns the name of a vehicle type.
+ *
+ * @param type TypeId stored in the trace.
+ * @return const std::string& Type name, or "Unknown" for ids outside the table.
+ */
+const string& TraceReader::type_Name(TypeId type) const
+{
+    static const string unknown = "Unknown";
+    return (type >= 0 && type < static_cast<TypeId>(type_Names.size())) ? type_Names[type] : unknown;
+}
\ No newline at end of file
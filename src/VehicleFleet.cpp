@@ -0,0 +1,714 @@
+#include <random>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "VehicleFleet.h"
+#include "CounterRng.h"
+#include "CertifiedTypes.h"
+#include "FleetKernels.h"
+
+using namespace std;
+
+/**
+ * @brief Creates an empty fleet.
+ *
+ * The seed is taken from std::random_device once per fleet; call set_Seed for a reproducible run.
+ *
+ * @param resource Memory every array allocates from, e.g. the SimulationArena of the owning simulation.
+ */
+VehicleFleet::VehicleFleet(pmr::memory_resource *resource)
+    : current_Battery(resource), actualCruiseSpeed(resource), session_FlightTime(resource), session_Distance(resource),
+      session_PassengerMiles(resource), next_FaultHours(resource), energy_PerMile(resource), battery_Capacity(resource),
+      charge_Rate(resource), passenger_Count(resource), cruiseSpeed(resource), fault_Probability(resource),
+      total_flightTime(resource), total_chargingTime(resource), fault_Count(resource), distanceFlown(resource),
+      passengerMiles(resource), type_Id(resource), rng_Counter(resource), certified_Type(resource),
+      charge_State(resource), charger_Slot(resource), queued_Since(resource), charged_Until(resource),
+      seed((static_cast<uint64_t>(random_device{}()) << 32) | random_device{}()), replica(0), branch(0) {}
+
+/**
+ * @brief Returns the memory resource the fleet's arrays allocate from.
+ *
+ * Containers sized per vehicle elsewhere, such as the charger queues, use it too so the
+ * whole simulation state shares one arena.
+ */
+pmr::memory_resource* VehicleFleet::resource() const
+{
+    return current_Battery.get_allocator().resource();
+}
+
+/**
+ * @brief Sets the key of every vehicle's random stream.
+ *
+ * Draws depend only on (seed, replica, vehicle id, draw index), so a vehicle sees the same
+ * numbers however the fleet is split across threads. Vehicles already in the fleet restart
+ * their stream and redraw their first fault time from the new key.
+ *
+ * @param seed Global seed of the run.
+ * @param replica Replication id within the run.
+ */
+void VehicleFleet::set_Seed(uint64_t seed, uint32_t replica)
+{
+    this->seed = seed;
+    this->replica = replica;
+    branch = 0;
+
+    for (size_t i = 0; i < size(); ++i)
+    {
+        int id = static_cast<int>(i);
+        rng_Counter[i] = 0;
+        next_FaultHours[i] = flight_Hours(id) + next_FaultInterval(id);
+    }
+}
+
+/**
+ * @brief Moves every vehicle onto the random substream of a forked branch.
+ *
+ * Vehicles keep their draw counts, but their pending fault times are redrawn from the new
+ * substream, starting at the flight hours already flown. Fault intervals are exponential,
+ * so the redrawn time has the same distribution as the one it replaces, and branches of one
+ * warm state diverge from their first draw.
+ *
+ * @param branch Branch id; branches with different ids draw independent numbers.
+ */
+void VehicleFleet::set_Branch(uint32_t branch)
+{
+    this->branch = branch;
+
+    for (size_t i = 0; i < size(); ++i)
+    {
+        int id = static_cast<int>(i);
+        next_FaultHours[i] = flight_Hours(id) + next_FaultInterval(id);
+    }
+}
+
+/**
+ * @brief Draws the next uniform number from a vehicle's random stream.
+ *
+ * @param id Vehicle id.
+ * @return double Uniform number in [0, 1).
+ */
+double VehicleFleet::draw_Uniform(int id)
+{
+    return CounterRng::uniform(seed, replica, static_cast<uint32_t>(id), rng_Counter[id]++, branch);
+}
+
+/**
+ * @brief Appends a vehicle with initial state based on the vehicle type.
+ *
+ * @param type Registered id of the vehicle type.
+ * @param vehicleType Reference to the Vehicle definition used to initialize this vehicle.
+ * @return int Id of the new vehicle, i.e. its index in every array.
+ */
+int VehicleFleet::add(TypeId type, const Vehicle &vehicleType)
+{
+    return add(type, vehicleType, 1);
+}
+
+/**
+ * @brief Appends a run of vehicles of the same type.
+ *
+ * Every array is extended once for the whole run, which is how large fleets from a
+ * manifest are built.
+ *
+ * @param type Registered id of the vehicle type.
+ * @param vehicleType Reference to the Vehicle definition used to initialize the vehicles.
+ * @param count Number of vehicles to append.
+ * @return int Id of the first new vehicle; the run occupies ids [first, first + count).
+ */
+int VehicleFleet::add(TypeId type, const Vehicle &vehicleType, size_t count)
+{
+    size_t first = size();
+
+    resize(first + count);
+    assign(first, first + count, type, vehicleType);
+    return static_cast<int>(first);
+}
+
+/**
+ * @brief Resets a range of vehicles to fully charged, unflown vehicles of one type.
+ *
+ * Each vehicle's random stream restarts and its first fault time is drawn again.
+ *
+ * @param begin First vehicle id of the range.
+ * @param end One past the last vehicle id of the range.
+ * @param type Registered id of the vehicle type.
+ * @param vehicleType Definition of the vehicle type.
+ */
+void VehicleFleet::assign(size_t begin, size_t end, TypeId type, const Vehicle &vehicleType)
+{
+    fill(current_Battery.begin() + begin, current_Battery.begin() + end, vehicleType.battery_Capacity);
+    fill(actualCruiseSpeed.begin() + begin, actualCruiseSpeed.begin() + end, vehicleType.cruiseSpeed);
+    fill(session_FlightTime.begin() + begin, session_FlightTime.begin() + end, 0.0);
+    fill(session_Distance.begin() + begin, session_Distance.begin() + end, 0.0);
+    fill(session_PassengerMiles.begin() + begin, session_PassengerMiles.begin() + end, 0);
+
+    fill(energy_PerMile.begin() + begin, energy_PerMile.begin() + end, vehicleType.energy_PerMile);
+    fill(battery_Capacity.begin() + begin, battery_Capacity.begin() + end, vehicleType.battery_Capacity);
+    fill(charge_Rate.begin() + begin, charge_Rate.begin() + end, vehicleType.battery_Capacity / vehicleType.timeTo_Charge);
+    fill(passenger_Count.begin() + begin, passenger_Count.begin() + end, vehicleType.passenger_Count);
+    fill(cruiseSpeed.begin() + begin, cruiseSpeed.begin() + end, vehicleType.cruiseSpeed);
+    if (begin < end)
+        match_Certified(type, begin);
+    fill(fault_Probability.begin() + begin, fault_Probability.begin() + end, vehicleType.fault_Probability);
+
+    fill(total_flightTime.begin() + begin, total_flightTime.begin() + end, 0.0);
+    fill(total_chargingTime.begin() + begin, total_chargingTime.begin() + end, 0.0);
+    fill(fault_Count.begin() + begin, fault_Count.begin() + end, 0);
+    fill(distanceFlown.begin() + begin, distanceFlown.begin() + end, 0.0);
+    fill(passengerMiles.begin() + begin, passengerMiles.begin() + end, 0);
+
+    fill(type_Id.begin() + begin, type_Id.begin() + end, type);
+    fill(rng_Counter.begin() + begin, rng_Counter.begin() + end, 0u);
+    fill(charge_State.begin() + begin, charge_State.begin() + end, ChargeState::Idle);
+    fill(charger_Slot.begin() + begin, charger_Slot.begin() + end, -1);
+    fill(queued_Since.begin() + begin, queued_Since.begin() + end, 0.0);
+    fill(charged_Until.begin() + begin, charged_Until.begin() + end, 0.0);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        next_FaultHours[i] = next_FaultInterval(static_cast<int>(i));   // First fault is drawn up front, later ones only when a fault fires
+    }
+}
+
+/**
+ * @brief Returns the number of vehicles in the fleet.
+ *
+ * @return size_t Vehicle count.
+ */
+size_t VehicleFleet::size() const
+{
+    return current_Battery.size();
+}
+
+/**
+ * @brief Grows or shrinks every array to a number of vehicles.
+ *
+ * New vehicles are zeroed; give them a type with assign() before simulating.
+ *
+ * @param count Number of vehicles the fleet holds afterwards.
+ */
+void VehicleFleet::resize(size_t count)
+{
+    current_Battery.resize(count);
+    actualCruiseSpeed.resize(count);
+    session_FlightTime.resize(count);
+    session_Distance.resize(count);
+    session_PassengerMiles.resize(count);
+    next_FaultHours.resize(count);
+    energy_PerMile.resize(count);
+    battery_Capacity.resize(count);
+    charge_Rate.resize(count);
+    passenger_Count.resize(count);
+    cruiseSpeed.resize(count);
+    fault_Probability.resize(count);
+    total_flightTime.resize(count);
+    total_chargingTime.resize(count);
+    fault_Count.resize(count);
+    distanceFlown.resize(count);
+    passengerMiles.resize(count);
+    type_Id.resize(count);
+    rng_Counter.resize(count);
+    charge_State.resize(count, ChargeState::Idle);
+    charger_Slot.resize(count, -1);
+    queued_Since.resize(count);
+    charged_Until.resize(count);
+}
+
+/**
+ * @brief Removes every vehicle from the fleet.
+ */
+void VehicleFleet::clear()
+{
+    current_Battery.clear();
+    actualCruiseSpeed.clear();
+    session_FlightTime.clear();
+    session_Distance.clear();
+    session_PassengerMiles.clear();
+    next_FaultHours.clear();
+    energy_PerMile.clear();
+    battery_Capacity.clear();
+    charge_Rate.clear();
+    passenger_Count.clear();
+    cruiseSpeed.clear();
+    fault_Probability.clear();
+    total_flightTime.clear();
+    total_chargingTime.clear();
+    fault_Count.clear();
+    distanceFlown.clear();
+    passengerMiles.clear();
+    type_Id.clear();
+    rng_Counter.clear();
+    charge_State.clear();
+    charger_Slot.clear();
+    queued_Since.clear();
+    charged_Until.clear();
+    certified_Type.clear();
+}
+
+/**
+ * @brief Records whether a type's kernel parameters match an entry of certified_Types.
+ *
+ * Energy use, passenger count, capacity and charge rate are compared exactly, so a type
+ * registered from the certified table matches and one with any parameter changed, e.g. by
+ * a sweep, does not.
+ *
+ * @param type Registered id of the vehicle type.
+ * @param id Any vehicle of that type.
+ */
+void VehicleFleet::match_Certified(TypeId type, size_t id)
+{
+    if (static_cast<size_t>(type) >= certified_Type.size())
+        certified_Type.resize(static_cast<size_t>(type) + 1, -1);
+
+    certified_Type[type] = -1;
+    for (size_t t = 0; t < certified_TypeCount; ++t)
+    {
+        const TypeSpec &spec = certified_Types[t];
+        if (energy_PerMile[id] == spec.energy_PerMile && passenger_Count[id] == spec.passenger_Count &&
+            battery_Capacity[id] == spec.battery_Capacity && charge_Rate[id] == spec.charge_Rate())
+        {
+            certified_Type[type] = static_cast<int>(t);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Simulates a block of vehicles flying for a given time increment.
+ *
+ * Updates current session flight time, distance, and passenger miles while reducing battery accordingly.
+ * If battery is insufficient, performs a partial flight. Vehicles with an empty battery stay grounded.
+ * The whole block is handed to the batch kernel in one call.
+ *
+ * @param begin First vehicle id of the block.
+ * @param end One past the last vehicle id of the block.
+ * @param time_increment Time step in hours to simulate flight.
+ */
+void VehicleFleet::fly(size_t begin, size_t end, double time_increment)
+{
+    if (begin >= end)
+        return;
+
+#if defined(EVTOL_CERTIFIED_TYPES)
+    while (begin < end)
+    {
+        size_t run = begin + 1;
+        while (run < end && type_Id[run] == type_Id[begin])
+            ++run;
+
+        int certified = certified_Type[type_Id[begin]];
+        if (certified >= 0)
+            FleetKernels::fly_Certified(static_cast<size_t>(certified), &current_Battery[begin], &actualCruiseSpeed[begin],
+                                        &session_FlightTime[begin], &session_Distance[begin], &session_PassengerMiles[begin],
+                                        run - begin, time_increment);
+        else
+            FleetKernels::fly(&current_Battery[begin], &actualCruiseSpeed[begin], &energy_PerMile[begin], &passenger_Count[begin],
+                              &session_FlightTime[begin], &session_Distance[begin], &session_PassengerMiles[begin],
+                              run - begin, time_increment);
+        begin = run;
+    }
+#else
+    FleetKernels::fly(&current_Battery[begin], &actualCruiseSpeed[begin], &energy_PerMile[begin], &passenger_Count[begin],
+                      &session_FlightTime[begin], &session_Distance[begin], &session_PassengerMiles[begin],
+                      end - begin, time_increment);
+#endif
+}
+
+/**
+ * @brief Flies the vehicles of a block that are neither queued nor on a charger.
+ *
+ * Idle vehicles are handed to the batch kernel in contiguous runs, so a fleet with few
+ * vehicles at the chargers still flies in a handful of kernel calls.
+ *
+ * @param begin First vehicle id of the block.
+ * @param end One past the last vehicle id of the block.
+ * @param time_increment Time step in hours to simulate flight.
+ */
+void VehicleFleet::fly_Idle(size_t begin, size_t end, double time_increment)
+{
+    while (begin < end)
+    {
+        while (begin < end && charge_State[begin] != ChargeState::Idle)
+            ++begin;
+
+        size_t run = begin;
+        while (run < end && charge_State[run] == ChargeState::Idle)
+            ++run;
+
+        fly(begin, run, time_increment);
+        begin = run;
+    }
+}
+
+/**
+ * @brief Simulates charging a block of vehicles for a given time increment.
+ *
+ * Adds energy based on charge rate, capped at battery capacity.
+ *
+ * @param begin First vehicle id of the block.
+ * @param end One past the last vehicle id of the block.
+ * @param time_increment Time step in hours to simulate charging.
+ */
+void VehicleFleet::charge(size_t begin, size_t end, double time_increment)
+{
+    if (begin >= end)
+        return;
+
+#if defined(EVTOL_CERTIFIED_TYPES)
+    while (begin < end)
+    {
+        size_t run = begin + 1;
+        while (run < end && type_Id[run] == type_Id[begin])
+            ++run;
+
+        int certified = certified_Type[type_Id[begin]];
+        if (certified >= 0)
+            FleetKernels::charge_Certified(static_cast<size_t>(certified), &current_Battery[begin], &total_chargingTime[begin],
+                                           run - begin, time_increment);
+        else
+            FleetKernels::charge(&current_Battery[begin], &charge_Rate[begin], &battery_Capacity[begin],
+                                 &total_chargingTime[begin], run - begin, time_increment);
+        begin = run;
+    }
+#else
+    FleetKernels::charge(&current_Battery[begin], &charge_Rate[begin], &battery_Capacity[begin],
+                         &total_chargingTime[begin], end - begin, time_increment);
+#endif
+}
+
+/**
+ * @brief Simulates charging the listed vehicles for a given time increment.
+ *
+ * @param ids Ids of the vehicles plugged into a charger.
+ * @param time_increment Time step in hours to simulate charging.
+ */
+void VehicleFleet::charge(const pmr::vector<int> &ids, double time_increment)
+{
+    for (int id : ids)
+    {
+        charge(id, time_increment);
+    }
+}
+
+/**
+ * @brief Records which vehicles in a block have an empty battery.
+ *
+ * @param begin First vehicle id of the block.
+ * @param end One past the last vehicle id of the block.
+ * @param depleted Output flags indexed by vehicle id; must hold at least end entries.
+ */
+void VehicleFleet::charge_depleted(size_t begin, size_t end, pmr::vector<char> &depleted) const
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        depleted[i] = current_Battery[i] <= 0.0;
+    }
+}
+
+/**
+ * @brief Simulates a single vehicle flying for a given time increment.
+ *
+ * @param id Vehicle id.
+ * @param time_increment Time step in hours to simulate flight.
+ */
+void VehicleFleet::fly(int id, double time_increment)
+{
+    fly(id, id + 1, time_increment);
+}
+
+/**
+ * @brief Simulates charging a single vehicle for a given time increment.
+ *
+ * @param id Vehicle id.
+ * @param time_increment Time step in hours to simulate charging.
+ */
+void VehicleFleet::charge(int id, double time_increment)
+{
+    charge(id, id + 1, time_increment);
+}
+
+/**
+ * @brief Simulates fault occurance.
+ *
+ * Faults form a Poisson process over flight hours, so each vehicle stores the flight hours
+ * at which its next fault happens. This only compares that mark against the hours flown;
+ * a random number is drawn only when a fault actually fires, to place the following one.
+ * A long step can cross more than one fault, so call it until it returns false.
+ *
+ * @param id Vehicle id.
+ * @return true if a fault occurs; false otherwise.
+ */
+bool VehicleFleet::simulate_Fault(int id)
+{
+    if (flight_Hours(id) < next_FaultHours[id])
+        return false;
+
+    record_Fault(id);
+    return true;
+}
+
+/**
+ * @brief Counts a fault and schedules the following one.
+ *
+ * The gap to the next fault is measured from the fault just recorded, not from the current
+ * flight hours, so faults crossed within one step keep their spacing.
+ *
+ * @param id Vehicle id.
+ */
+void VehicleFleet::record_Fault(int id)
+{
+    fault_Count[id]++;
+    next_FaultHours[id] += next_FaultInterval(id);
+}
+
+/**
+ * @brief Checks if the battery is fully depleted.
+ *
+ * @param id Vehicle id.
+ * @return true if battery is empty; false otherwise.
+ */
+bool VehicleFleet::charge_depleted(int id) const
+{
+    return current_Battery[id] <= 0.0;
+}
+
+/**
+ * @brief Checks if the battery is fully charged.
+ *
+ * @param id Vehicle id.
+ * @return true if battery is at full capacity; false otherwise.
+ */
+bool VehicleFleet::charge_completed(int id) const
+{
+    return fabs(current_Battery[id] - battery_Capacity[id]) < charge_Tolerance;  // Small epsilon tolerance added to account for floating-point precision
+}
+
+/**
+ * @brief Transfers current session flight parameters to total stats and resets session values.
+ *
+ * @param id Vehicle id.
+ */
+void VehicleFleet::finalize_FlightSession(int id)
+{
+    if (session_FlightTime[id] > 0)
+    {
+        total_flightTime[id] += session_FlightTime[id];
+        distanceFlown[id] += session_Distance[id];
+        passengerMiles[id] += session_PassengerMiles[id];
+
+        // Restting values
+        session_FlightTime[id] = 0;
+        session_Distance[id] = 0;
+        session_PassengerMiles[id] = 0;
+    }
+}
+
+/**
+ * @brief Computes how long the vehicle can keep flying before the battery is empty.
+ *
+ * @param id Vehicle id.
+ * @return double Remaining flight time in hours at the current cruise speed.
+ */
+double VehicleFleet::time_ToDepletion(int id) const
+{
+    return current_Battery[id] / (actualCruiseSpeed[id] * energy_PerMile[id]);
+}
+
+/**
+ * @brief Brings a charging vehicle's battery and charging time up to a charger clock time.
+ *
+ * ChargerManager charges lazily: a vehicle on a charger only has its battery advanced when
+ * it is queried or leaves the charger, by the whole time since it was last brought up to date.
+ *
+ * @param id Vehicle id.
+ * @param time Charger clock time; earlier than the last update leaves the vehicle unchanged.
+ */
+void VehicleFleet::charge_Until(int id, double time)
+{
+    if (time > charged_Until[id])
+    {
+        charge(id, time - charged_Until[id]);
+        charged_Until[id] = time;
+    }
+}
+
+/**
+ * @brief Computes the charger clock time at which a charging vehicle counts as full.
+ *
+ * That is the moment its battery comes within the tolerance of charge_completed, measured
+ * from the last time it was brought up to date.
+ *
+ * @param id Vehicle id.
+ * @return double Charger clock time of completion, no later than charged_Until for a full battery.
+ */
+double VehicleFleet::charge_CompleteAt(int id) const
+{
+    return charged_Until[id] + (battery_Capacity[id] - current_Battery[id] - charge_Tolerance) / charge_Rate[id];
+}
+
+/**
+ * @brief Computes how long the vehicle must charge to reach full capacity.
+ *
+ * @param id Vehicle id.
+ * @return double Remaining charging time in hours.
+ */
+double VehicleFleet::time_ToFullCharge(int id) const
+{
+    return (battery_Capacity[id] - current_Battery[id]) / charge_Rate[id];
+}
+
+/**
+ * @brief Returns the flight hours accumulated by a vehicle, including the current session.
+ *
+ * @param id Vehicle id.
+ * @return double Total hours flown.
+ */
+double VehicleFleet::flight_Hours(int id) const
+{
+    return total_flightTime[id] + session_FlightTime[id];
+}
+
+/**
+ * @brief Computes how much more the vehicle can fly before its next fault.
+ *
+ * @param id Vehicle id.
+ * @return double Remaining flight hours until the next fault, infinity if it never faults.
+ */
+double VehicleFleet::time_ToNextFault(int id) const
+{
+    return next_FaultHours[id] - flight_Hours(id);
+}
+
+/**
+ * @brief Draws the flight time until the next fault.
+ *
+ * Faults are treated as a Poisson process with fault_Probability faults per flight hour,
+ * so the gap between faults is exponentially distributed.
+ *
+ * @param id Vehicle id.
+ * @return double Hours of flight until the next fault, or infinity if the vehicle never faults.
+ */
+double VehicleFleet::next_FaultInterval(int id)
+{
+    if (fault_Probability[id] <= 0.0)
+        return numeric_limits<double>::infinity();
+
+    return -log1p(-draw_Uniform(id)) / fault_Probability[id];      // Inverse CDF of the exponential distribution
+}
+
+/**
+ * @brief Writes the whole fleet to a checkpoint.
+ *
+ * Every array is written with a single copy, followed by the seed, replica and branch ids,
+ * so a restored fleet continues every vehicle's random stream where it stopped.
+ *
+ * @param out Checkpoint being written.
+ */
+void VehicleFleet::save(CheckpointWriter &out) const
+{
+    out.write(current_Battery);
+    out.write(actualCruiseSpeed);
+    out.write(session_FlightTime);
+    out.write(session_Distance);
+    out.write(session_PassengerMiles);
+    out.write(next_FaultHours);
+    out.write(energy_PerMile);
+    out.write(battery_Capacity);
+    out.write(charge_Rate);
+    out.write(passenger_Count);
+    out.write(cruiseSpeed);
+    out.write(fault_Probability);
+    out.write(total_flightTime);
+    out.write(total_chargingTime);
+    out.write(fault_Count);
+    out.write(distanceFlown);
+    out.write(passengerMiles);
+    out.write(type_Id);
+    out.write(rng_Counter);
+    out.write(charge_State);
+    out.write(charger_Slot);
+    out.write(queued_Since);
+    out.write(charged_Until);
+    out.write(seed);
+    out.write(replica);
+    out.write(branch);
+}
+
+/**
+ * @brief Replaces the fleet with one written by save().
+ *
+ * @param in Checkpoint positioned at the fleet.
+ * @param type_Count Number of registered types; every vehicle's type must be below it.
+ * @return true if every array was read, all have the same length and every type is registered; false otherwise.
+ */
+bool VehicleFleet::load(CheckpointReader &in, size_t type_Count)
+{
+    bool ok = in.read(current_Battery) &&
+              in.read(actualCruiseSpeed) &&
+              in.read(session_FlightTime) &&
+              in.read(session_Distance) &&
+              in.read(session_PassengerMiles) &&
+              in.read(next_FaultHours) &&
+              in.read(energy_PerMile) &&
+              in.read(battery_Capacity) &&
+              in.read(charge_Rate) &&
+              in.read(passenger_Count) &&
+              in.read(cruiseSpeed) &&
+              in.read(fault_Probability) &&
+              in.read(total_flightTime) &&
+              in.read(total_chargingTime) &&
+              in.read(fault_Count) &&
+              in.read(distanceFlown) &&
+              in.read(passengerMiles) &&
+              in.read(type_Id) &&
+              in.read(rng_Counter) &&
+              in.read(charge_State) &&
+              in.read(charger_Slot) &&
+              in.read(queued_Since) &&
+              in.read(charged_Until) &&
+              in.read(seed) && in.read(replica) && in.read(branch);
+    if (!ok)
+        return false;
+
+    size_t n = current_Battery.size();
+    bool same = actualCruiseSpeed.size() == n &&
+                session_FlightTime.size() == n &&
+                session_Distance.size() == n &&
+                session_PassengerMiles.size() == n &&
+                next_FaultHours.size() == n &&
+                energy_PerMile.size() == n &&
+                battery_Capacity.size() == n &&
+                charge_Rate.size() == n &&
+                passenger_Count.size() == n &&
+                cruiseSpeed.size() == n &&
+                fault_Probability.size() == n &&
+                total_flightTime.size() == n &&
+                total_chargingTime.size() == n &&
+                fault_Count.size() == n &&
+                distanceFlown.size() == n &&
+                passengerMiles.size() == n &&
+                type_Id.size() == n &&
+                rng_Counter.size() == n &&
+                charge_State.size() == n &&
+                charger_Slot.size() == n &&
+                queued_Since.size() == n &&
+                charged_Until.size() == n;
+    if (!same)
+        return false;
+
+    certified_Type.clear();
+    vector<char> seen(type_Count, 0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        TypeId type = type_Id[i];
+        if (type < 0 || static_cast<size_t>(type) >= type_Count)
+            return false;                           // A damaged id would index past the types and their statistics
+        if (!seen[type])
+        {
+            seen[type] = 1;
+            match_Certified(type, i);               // Rebuilt rather than saved, it depends on this build's table
+        }
+    }
+    return true;
+}
\ No newline at end of file
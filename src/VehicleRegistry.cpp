@@ -0,0 +1,106 @@
+#include "VehicleRegistry.h"
+
+using namespace std;
+
+/**
+ * @brief Registers a vehicle type and assigns it the next free TypeId.
+ *
+ * Registering a name that already exists returns the existing id and keeps the first definition.
+ *
+ * @param vehicleType Definition of the vehicle type.
+ * @return TypeId Dense id of the type.
+ */
+TypeId VehicleRegistry::register_Type(const Vehicle &vehicleType)
+{
+    auto it = ids.find(vehicleType.name);
+    if (it != ids.end())
+        return it->second;
+
+    TypeId id = static_cast<TypeId>(types.size());
+    types.push_back(vehicleType);
+    ids.emplace(vehicleType.name, id);
+    return id;
+}
+
+/**
+ * @brief Looks up the id of a registered type by name.
+ *
+ * @param name Name of the vehicle type.
+ * @return TypeId Id of the type, or -1 if it was never registered.
+ */
+TypeId VehicleRegistry::find(const string &name) const
+{
+    auto it = ids.find(name);
+    return it != ids.end() ? it->second : -1;
+}
+
+/**
+ * @brief Returns the definition of a registered type.
+ *
+ * @param id Id of the vehicle type.
+ * @return const Vehicle& Shared definition of the type.
+ */
+const Vehicle& VehicleRegistry::get(TypeId id) const
+{
+    return types[id];
+}
+
+/**
+ * @brief Returns the number of registered types.
+ *
+ * @return size_t Type count.
+ */
+size_t VehicleRegistry::size() const
+{
+    return types.size();
+}
+
+/**
+ * @brief Writes every type definition to a checkpoint, in TypeId order.
+ *
+ * @param out Checkpoint being written.
+ */
+void VehicleRegistry::save(CheckpointWriter &out) const
+{
+    out.write(static_cast<uint64_t>(types.size()));
+    for (const Vehicle &v : types)
+    {
+        out.write(v.name);
+        out.write(v.cruiseSpeed);
+        out.write(v.battery_Capacity);
+        out.write(v.timeTo_Charge);
+        out.write(v.energy_PerMile);
+        out.write(v.passenger_Count);
+        out.write(v.fault_Probability);
+    }
+}
+
+/**
+ * @brief Replaces every type with those written by save(), keeping their TypeIds.
+ *
+ * @param in Checkpoint positioned at the registry.
+ * @return true if every type was read and the names are distinct; false otherwise.
+ */
+bool VehicleRegistry::load(CheckpointReader &in)
+{
+    types.clear();
+    ids.clear();
+
+    uint64_t count = 0;
+    if (!in.read(count) || count > 65536)
+        return false;
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        string name;
+        double cruiseSpeed, battery_Capacity, timeTo_Charge, energy_PerMile, fault_Probability;
+        int passenger_Count;
+        if (!(in.read(name) && in.read(cruiseSpeed) && in.read(battery_Capacity) && in.read(timeTo_Charge) &&
+              in.read(energy_PerMile) && in.read(passenger_Count) && in.read(fault_Probability)))
+            return false;
+
+        if (register_Type(Vehicle(name, cruiseSpeed, battery_Capacity, timeTo_Charge, energy_PerMile, passenger_Count, fault_Probability)) != static_cast<TypeId>(i))
+            return false;
+    }
+    return true;
+}
\ No newline at end of file
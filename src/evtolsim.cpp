@@ -0,0 +1,216 @@
+#include <string>
+#include <vector>
+#include <memory>
+#include <exception>
+
+#include "evtolsim.h"
+#include "Simulation.h"
+
+using namespace std;
+
+/**
+ * @brief A simulation behind the C handle.
+ */
+struct evtol_sim{
+    Simulation sim;                         // The simulation being stepped
+};
+
+namespace
+{
+    thread_local string last_Error;         // Reason the last call on this thread failed, empty if it succeeded
+
+    /**
+     * @brief Records why a simulation could not be created.
+     *
+     * @param message Text returned by evtol_last_error.
+     * @return nullptr, for returning straight out of evtol_create.
+     */
+    evtol_sim* fail(const string &message)
+    {
+        last_Error = message;
+        return nullptr;
+    }
+
+    /**
+     * @brief Runs a call into the simulation, turning any exception into a message instead.
+     *
+     * Exceptions must not unwind into a C caller, e.g. a std::system_error from starting the
+     * tick threads on the first step.
+     *
+     * @param call Work to run.
+     * @return true if the call returned normally; false if it threw, with the reason in last_Error.
+     */
+    template <class Call>
+    bool guard(Call call)
+    {
+        last_Error.clear();
+        try
+        {
+            call();
+            return true;
+        }
+        catch (const exception &e)
+        {
+            last_Error = e.what();
+        }
+        catch (...)
+        {
+            last_Error = "Unknown error in the simulation";
+        }
+        return false;
+    }
+}
+
+void evtol_config_init(evtol_config *config)
+{
+    config->manifest_path = nullptr;
+    config->checkpoint_path = nullptr;
+    config->seed = 0;
+    config->replica = 0;
+    config->time_increment = 0.5;
+    config->sites = 1;
+    config->chargers_per_site = 3;
+    config->tick_threads = 1;
+    config->site_threads = 1;
+}
+
+/**
+ * @brief Creates a simulation with no fault log and no summary, then builds or restores its fleet.
+ *
+ * No exception leaves this function; a failure of any kind returns nullptr with the reason
+ * in evtol_last_error.
+ */
+evtol_sim* evtol_create(const evtol_config *config)
+{
+    last_Error.clear();
+    if (!config)
+        return fail("No configuration given");
+    if (!(config->time_increment > 0))
+        return fail("time_increment must be positive");
+    if (config->sites < 1 || config->chargers_per_site < 0)
+        return fail("Need at least one site and a non-negative charger count");
+
+    try
+    {
+        FleetManifest manifest;
+        if (config->manifest_path && !config->checkpoint_path && !manifest.load(config->manifest_path))
+            return fail(manifest.error);
+
+        unique_ptr<evtol_sim> handle(new evtol_sim);   // Freed if anything below fails
+        Simulation &sim = handle->sim;
+        sim.set_PrintSummary(false);
+        sim.set_FaultLogPath("");           // Stepping never touches the disk
+        sim.set_Seed(config->seed, config->replica);
+        sim.set_TimeIncrement(config->time_increment);
+        sim.get_Chargers().set_Sites(vector<int>(config->sites, config->chargers_per_site));
+        sim.get_Chargers().set_Threads(config->site_threads > 0 ? config->site_threads : 1);
+        sim.set_TickThreads(config->tick_threads > 0 ? config->tick_threads : 1);
+
+        if (config->checkpoint_path)
+        {
+            if (!sim.load_Checkpoint(config->checkpoint_path))
+                return fail(string("Cannot restore checkpoint ") + config->checkpoint_path);
+        }
+        else if (config->manifest_path)
+            sim.vehicle_Init(manifest);
+        else
+            sim.vehicle_Init();
+        return handle.release();
+    }
+    catch (const exception &e)
+    {
+        return fail(e.what());
+    }
+    catch (...)
+    {
+        return fail("Unknown error creating the simulation");
+    }
+}
+
+void evtol_destroy(evtol_sim *sim)
+{
+    delete sim;
+}
+
+double evtol_step(evtol_sim *sim, uint64_t ticks)
+{
+    if (!guard([&] { sim->sim.step(static_cast<size_t>(ticks)); }))
+        return -1.0;
+    return sim->sim.get_CurrentTime();
+}
+
+double evtol_advance_to(evtol_sim *sim, double time)
+{
+    if (!guard([&] { sim->sim.advance_To(time); }))
+        return -1.0;
+    return sim->sim.get_CurrentTime();
+}
+
+double evtol_time(const evtol_sim *sim)
+{
+    return sim->sim.get_CurrentTime();
+}
+
+/**
+ * @brief Points the view at the fleet's arrays after settling the lazily charged batteries.
+ *
+ * Only the settling runs simulation code; taking the pointers cannot fail.
+ */
+int evtol_fleet(evtol_sim *sim, evtol_fleet_view *view)
+{
+    if (!guard([&] { sim->sim.get_Chargers().sync(); }))
+        return 0;
+    const VehicleFleet &fleet = sim->sim.get_Fleet();
+    static_assert(sizeof(ChargeState) == sizeof(uint8_t), "charge_state is exposed as bytes");
+
+    view->count = fleet.size();
+    view->battery = fleet.current_Battery.data();
+    view->battery_capacity = fleet.battery_Capacity.data();
+    view->cruise_speed = fleet.actualCruiseSpeed.data();
+    view->session_flight_time = fleet.session_FlightTime.data();
+    view->total_flight_time = fleet.total_flightTime.data();
+    view->distance_flown = fleet.distanceFlown.data();
+    view->fault_count = fleet.fault_Count.data();
+    view->passenger_miles = fleet.passengerMiles.data();
+    view->type_id = fleet.type_Id.data();
+    view->charge_state = reinterpret_cast<const uint8_t*>(fleet.charge_State.data());
+    return 1;
+}
+
+/**
+ * @brief Points the view at the members of the first Stats entry; entries are sizeof(Stats) apart.
+ */
+void evtol_stats(const evtol_sim *sim, evtol_stats_view *view)
+{
+    const vector<Stats> &list = sim->sim.getStats().StatList;
+
+    view->count = list.size();
+    view->stride = sizeof(Stats);
+    if (list.empty())
+    {
+        view->total_flight_time = view->total_distance = view->total_charging_time = nullptr;
+        view->total_faults = view->total_passenger_miles = view->flight_count = view->charge_count = nullptr;
+        return;
+    }
+    const Stats &first = list.front();
+    view->total_flight_time = &first.total_FlightTime;
+    view->total_distance = &first.total_Distance;
+    view->total_charging_time = &first.total_ChargingTime;
+    view->total_faults = &first.total_Faults;
+    view->total_passenger_miles = &first.total_PassengerMiles;
+    view->flight_count = &first.flight_count;
+    view->charge_count = &first.charge_count;
+}
+
+const char* evtol_type_name(const evtol_sim *sim, int type)
+{
+    const vector<string> &names = sim->sim.getStats().type_Names;
+    if (type < 0 || static_cast<size_t>(type) >= names.size())
+        return nullptr;
+    return names[type].c_str();
+}
+
+const char* evtol_last_error(void)
+{
+    return last_Error.c_str();
+}
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
 
 #include "Simulation.h"
+#include "ReplicationRunner.h"
+#include "ParameterSweep.h"
 
 /**
  * @brief Main function to initialize vehicles and run the complete simulation.
@@ -8,14 +14,166 @@
  * Initializes the simulation environment, loads vehicle types and instances,
  * and runs the simulation loop until completion.
  * 
- * @return int Returns 0 upon successful execution.
+ * Options:
+ *   --event             run the discrete-event engine instead of the fixed-step loop
+ *   --replications N    run N independent simulations in parallel and print mean +/- 95% CI
+ *   --seed S            make the run reproducible
+ *   --binary-faults     write fault_log.txt as binary FaultRecords instead of text lines
+ *   --trace FILE        record every flight, charger and fault event to a binary trace for evtol-trace
+ *   --manifest FILE     read vehicle types and fleet composition from a CSV or JSON manifest
+ *   --sites N           spread the vehicles over N charging sites with 3 chargers each
+ *   --site-threads T    update the charging sites on T threads
+ *   --tick-threads T    fly and settle the fleet on T threads in the fixed-step loop
+ *   --perf-counters     add cycles and cache misses to the phase profile (EVTOL_PROFILE builds on Linux)
+ *   --resume FILE       continue from a checkpoint instead of building a new fleet
+ *   --checkpoint FILE   save the complete simulation state to FILE after the run
+ *   --sweep FILE        run every point of a sweep spec over the --manifest fleet, --replications N times each
+ *   --sweep-out FILE    write the sweep results table to FILE instead of sweep_results.csv
+ * 
+ * @return int Returns 0 upon successful execution, 1 if the manifest, checkpoint or sweep cannot be read or written.
  */
-int main()
+int main(int argc, char *argv[])
 {
+    bool event_Driven = false;
+    int replications = 0;
+    bool seeded = false;
+    uint64_t seed = 0;
+    bool binary_Faults = false;
+    const char *trace_Path = nullptr;
+    const char *manifest_Path = nullptr;
+    int site_Count = 1;
+    int site_Threads = 1;
+    int tick_Threads = 1;
+    bool perf_Counters = false;
+    const char *resume_Path = nullptr;
+    const char *checkpoint_Path = nullptr;
+    const char *sweep_Path = nullptr;
+    const char *sweep_Out = "sweep_results.csv";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--event") == 0)
+            event_Driven = true;
+        else if (std::strcmp(argv[i], "--replications") == 0 && i + 1 < argc)
+            replications = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+            seeded = true;
+        }
+        else if (std::strcmp(argv[i], "--binary-faults") == 0)
+            binary_Faults = true;
+        else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+            trace_Path = argv[++i];
+        else if (std::strcmp(argv[i], "--manifest") == 0 && i + 1 < argc)
+            manifest_Path = argv[++i];
+        else if (std::strcmp(argv[i], "--sites") == 0 && i + 1 < argc)
+            site_Count = std::max(std::atoi(argv[++i]), 1);
+        else if (std::strcmp(argv[i], "--site-threads") == 0 && i + 1 < argc)
+            site_Threads = std::max(std::atoi(argv[++i]), 1);
+        else if (std::strcmp(argv[i], "--tick-threads") == 0 && i + 1 < argc)
+            tick_Threads = std::max(std::atoi(argv[++i]), 1);
+        else if (std::strcmp(argv[i], "--perf-counters") == 0)
+            perf_Counters = true;
+        else if (std::strcmp(argv[i], "--resume") == 0 && i + 1 < argc)
+            resume_Path = argv[++i];
+        else if (std::strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc)
+            checkpoint_Path = argv[++i];
+        else if (std::strcmp(argv[i], "--sweep") == 0 && i + 1 < argc)
+            sweep_Path = argv[++i];
+        else if (std::strcmp(argv[i], "--sweep-out") == 0 && i + 1 < argc)
+            sweep_Out = argv[++i];
+    }
+
+    std::vector<int> site_Chargers(site_Count, 3);
+
+    FleetManifest manifest;
+    if (manifest_Path && !manifest.load(manifest_Path))
+    {
+        std::cerr << manifest.error << std::endl;
+        return 1;
+    }
+
+    if (sweep_Path)
+    {
+        if (!manifest_Path)
+        {
+            std::cerr << "--sweep needs a --manifest describing the base fleet" << std::endl;
+            return 1;
+        }
+
+        ParameterSweep sweep(manifest, std::thread::hardware_concurrency(), event_Driven);
+        if (seeded)
+            sweep.set_Seed(seed);
+        if (!sweep.load(sweep_Path))
+        {
+            std::cerr << sweep.error << std::endl;
+            return 1;
+        }
+        if (replications > 0)
+            sweep.set_Replications(replications);   // Overrides the spec
+
+        sweep.run();
+        if (!sweep.save_Table(sweep_Out))
+        {
+            std::cerr << "Cannot write sweep results " << sweep_Out << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << sweep.get_Results().size() << " sweep points to " << sweep_Out << std::endl;
+        return 0;
+    }
+
+    if (replications > 0)
+    {
+        ReplicationRunner runner(replications, std::thread::hardware_concurrency(), event_Driven);
+        if (seeded)
+            runner.set_Seed(seed);
+        runner.set_Setup([&](Simulation &sim, int) {
+            sim.get_Chargers().set_Sites(site_Chargers);
+            if (manifest_Path)
+                sim.vehicle_Init(manifest);     // Parsed once, shared by every replica
+            else
+                sim.vehicle_Init();
+        });
+        runner.run();
+        runner.print_Summary();
+        return 0;
+    }
+
     Simulation sim;
 
-    sim.vehicle_Init();     // Initializes vehicle instances with given configurations
-    sim.run_Sim();          // Runs the simulation for 3 hours
+    if (seeded)
+        sim.set_Seed(seed);
+    if (binary_Faults)
+        sim.get_FaultLog().set_Format(FaultLogFormat::Binary);
+    if (trace_Path)
+        sim.set_TracePath(trace_Path);
+    sim.get_Chargers().set_Sites(site_Chargers);
+    sim.get_Chargers().set_Threads(site_Threads);
+    sim.set_TickThreads(tick_Threads);
+    sim.get_Profiler().set_HardwareCounters(perf_Counters);
+    if (resume_Path)
+    {
+        if (!sim.load_Checkpoint(resume_Path))
+        {
+            std::cerr << "Cannot restore checkpoint " << resume_Path << std::endl;
+            return 1;
+        }
+    }
+    else if (manifest_Path)
+        sim.vehicle_Init(manifest);
+    else
+        sim.vehicle_Init(); // Initializes vehicle instances with given configurations
+
+    if (event_Driven)
+        sim.run_EventSim(); // Jumps from event to event for the same 3 hours
+    else
+        sim.run_Sim();      // Runs the simulation for 3 hours
 
+    if (checkpoint_Path && !sim.save_Checkpoint(checkpoint_Path))
+    {
+        std::cerr << "Cannot write checkpoint " << checkpoint_Path << std::endl;
+        return 1;
+    }
     return 0;
 }
\ No newline at end of file
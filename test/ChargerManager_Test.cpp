@@ -1,9 +1,11 @@
 #include <iostream>
 #include <vector>
 #include <cassert>
+#include <cmath>
+#include <string>
 
 #include "Vehicle.h"
-#include "Vehicle_Instance.h"
+#include "VehicleFleet.h"
 #include "ChargerManager.h"
 #include "Statistics.h"
 
@@ -29,16 +31,16 @@ using namespace std;
  */
 void test_AddToCharging_WhenAvailable() {
     Statistics stats;
-    ChargerManager manager(stats, 2);
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 2);
     Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
-    VehicleInstance* v1 = new VehicleInstance(v);
+    stats.register_Type(0, v.name);
+    int v1 = fleet.add(0, v);
 
     manager.charge_Request(v1);
     manager.charge_Update(1.0);
 
     ASSERT_TRUE(manager.charger_Availability() == true, "\tCharger should still have capacity");
-
-    delete v1;
 }
 
 /**
@@ -48,19 +50,18 @@ void test_AddToCharging_WhenAvailable() {
  */
 void test_AddToQueue_WhenFull() {
     Statistics stats;
-    ChargerManager manager(stats, 1);
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
     Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
-    VehicleInstance* v1 = new VehicleInstance(v);
-    VehicleInstance* v2 = new VehicleInstance(v);
+    stats.register_Type(0, v.name);
+    int v1 = fleet.add(0, v);
+    int v2 = fleet.add(0, v);
 
     manager.charge_Request(v1);
     manager.charge_Request(v2);
     manager.charge_Update(1.0);
 
     ASSERT_TRUE(manager.charger_Availability() == false, "\tSecond vehicle should wait in queue");
-
-    delete v1;
-    delete v2;
 }
 
 /**
@@ -70,19 +71,18 @@ void test_AddToQueue_WhenFull() {
  */
 void test_PromotionFrom_Queue() {
     Statistics stats;
-    ChargerManager manager(stats, 1);
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
     Vehicle v("TestVehicle", 100, 100, 0.1, 1, 4, 0.0);
-    VehicleInstance* v1 = new VehicleInstance(v);
-    VehicleInstance* v2 = new VehicleInstance(v);
+    stats.register_Type(0, v.name);
+    int v1 = fleet.add(0, v);
+    int v2 = fleet.add(0, v);
 
     manager.charge_Request(v1);
     manager.charge_Request(v2);
     manager.charge_Update(0.1);
     
     ASSERT_TRUE(manager.charger_Availability() == false, "\tSecond vehicle should be promoted after first finishes");
-
-    delete v1;
-    delete v2;
 }
 
 /**
@@ -92,12 +92,14 @@ void test_PromotionFrom_Queue() {
  */
 void test_NoOverfill_BeyondCapacity() {
     Statistics stats;
-    ChargerManager manager(stats, 3);
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 3);
     Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
-    VehicleInstance* v1 = new VehicleInstance(v);
-    VehicleInstance* v2 = new VehicleInstance(v);
-    VehicleInstance* v3 = new VehicleInstance(v);
-    VehicleInstance* v4 = new VehicleInstance(v);
+    stats.register_Type(0, v.name);
+    int v1 = fleet.add(0, v);
+    int v2 = fleet.add(0, v);
+    int v3 = fleet.add(0, v);
+    int v4 = fleet.add(0, v);
 
     manager.charge_Request(v1);
     manager.charge_Request(v2);
@@ -105,10 +107,6 @@ void test_NoOverfill_BeyondCapacity() {
     manager.charge_Request(v4); // should go to queue
 
     ASSERT_TRUE(manager.charger_Availability() == false, "\tOnly 3 vehicles can charge at a time");
-    delete v1;
-    delete v2;
-    delete v3;
-    delete v4;
 }
 
 /**
@@ -118,17 +116,209 @@ void test_NoOverfill_BeyondCapacity() {
  */
 void test_DuplicateChargeRequest_Ignored() {
     Statistics stats;
-    ChargerManager manager(stats, 2);
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 2);
     Vehicle v("DupVehicle", 100, 100, 1, 1, 4, 0.0);
-    VehicleInstance* vi = new VehicleInstance(v);
+    stats.register_Type(0, v.name);
+    int vi = fleet.add(0, v);
 
     manager.charge_Request(vi);
     manager.charge_Request(vi); // Second request should be ignored
     manager.charge_Update(1.0);
 
     ASSERT_TRUE(stats.get_ChargerCount("DupVehicle") <= 1, "\tDuplicate charge request should be ignored");
+}
+
+/**
+ * @brief Tests that releasing a charger hands it to the front of the queue.
+ * 
+ * Used by the event-driven engine, which frees chargers at exact completion times.
+ */
+void test_ReleasePromotesQueuedVehicle() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int v1 = fleet.add(0, v);
+    int v2 = fleet.add(0, v);
+
+    manager.charge_Request(v1);
+    manager.charge_Request(v2);
+    int promoted = manager.charge_Release(v1);
+
+    ASSERT_TRUE(promoted == v2, "\tQueued vehicle should be promoted on release");
+    ASSERT_TRUE(manager.is_Charging(v2) && !manager.is_Charging(v1), "\tReleased vehicle should no longer hold the charger");
+}
+
+/**
+ * @brief Tests that a batched request queues vehicles in the order given.
+ * 
+ * Ensures the batch behaves like individual requests and skips vehicles already known.
+ */
+void test_BatchedRequest_KeepsOrder() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int first = fleet.add(0, v, 4);
+
+    vector<int> ids = {first + 2, first, first + 2, first + 3};
+    manager.charge_Request(ids.data(), ids.size());
+
+    ASSERT_TRUE(manager.is_Charging(first + 2) && manager.queue_Length() == 2, "\tBatch should fill the charger and queue the rest once each");
+    ASSERT_TRUE(manager.charge_Release(first + 2) == first, "\tQueued vehicles should be promoted in batch order");
+    ASSERT_TRUE(manager.charge_Release(first) == first + 3, "\tLast vehicle of the batch should be promoted last");
+}
+
+/**
+ * @brief Tests that the charger state is stored on the fleet.
+ * 
+ * Checks the state and slot of each vehicle as it charges, queues, leaves, and after reset.
+ */
+void test_StateStoredOnFleet() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 2);
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int first = fleet.add(0, v, 3);
+
+    vector<int> ids = {first, first + 1, first + 2};
+    manager.charge_Request(ids.data(), ids.size());
+    ASSERT_TRUE(fleet.charge_State[first] == ChargeState::Charging && fleet.charge_State[first + 2] == ChargeState::Queued,
+                "\tFleet should hold charging and queued states");
+
+    manager.charge_Release(first);                  // Last slot moves into the freed one
+    ASSERT_TRUE(fleet.charge_State[first] == ChargeState::Idle && fleet.charger_Slot[first] == -1, "\tReleased vehicle should be idle with no slot");
+    ASSERT_TRUE(fleet.charger_Slot[first + 1] == 0 && fleet.charger_Slot[first + 2] == 1, "\tSwap-remove should keep slots packed");
+
+    manager.reset();
+    ASSERT_TRUE(fleet.charge_State[first + 1] == ChargeState::Idle && fleet.charge_State[first + 2] == ChargeState::Idle,
+                "\tReset should set every held vehicle back to idle");
+    ASSERT_TRUE(manager.charger_Availability() && manager.queue_Length() == 0, "\tReset should free every charger and empty the queue");
+}
+
+/**
+ * @brief Tests that the wait queue stays first-in first-out as the ring wraps around.
+ * 
+ * Vehicles join and leave the queue many more times than the ring has slots.
+ */
+void test_QueueWrapsAround() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int count = 40;
+    int first = fleet.add(0, v, count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        manager.charge_Request(first + i);
+    }
+
+    bool inOrder = true;
+    int holder = first;
+    for (int round = 0; round < 5 * count; ++round)
+    {
+        int next = manager.charge_Release(holder);
+        inOrder = inOrder && next == first + (holder - first + 1) % count;
+        manager.charge_Request(holder);                     // Rejoin the back of the queue
+        holder = next;
+    }
+
+    ASSERT_TRUE(inOrder, "\tQueue should promote in arrival order across wrap-around");
+    ASSERT_TRUE(manager.queue_Length() == static_cast<size_t>(count - 1), "\tQueue should hold every vehicle but the one charging");
+}
+
+/**
+ * @brief Tests that the time each vehicle spends queued is logged when it gets a charger.
+ * 
+ * The first vehicle plugs in straight away; the second waits until the first is released.
+ */
+void test_QueueWaitLogged() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int first = fleet.add(0, v, 2);
+
+    manager.set_Clock(1.0);
+    manager.charge_Request(first);
+    manager.charge_Request(first + 1);
+    manager.set_Clock(1.75);
+    manager.charge_Release(first);
+
+    const Distribution &waits = stats.StatList[0].queue_Wait;
+    ASSERT_TRUE(waits.count() == 2 && waits.min() == 0.0 && waits.max() == 0.75, "\tQueue waits should be logged from request to charger");
+}
+
+/**
+ * @brief Tests that a charging vehicle is only charged on plug-in, when synced and when it finishes.
+ * 
+ * Charging 100 kWh at 100 kWh per hour in quarter-hour steps shows the first step's charge,
+ * then keeps that level until synced, and finishes on the fourth step with one hour charged.
+ */
+void test_LazyChargingCompletesOnTime() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1.0, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int id = fleet.add(0, v);
+    fleet.current_Battery[id] = 0.0;
+
+    manager.charge_Request(id);
+    manager.charge_Update(0.25);
+    ASSERT_TRUE(fleet.current_Battery[id] == 25.0, "\tThe first update should charge a newly plugged vehicle");
+
+    manager.charge_Update(0.25);
+    manager.charge_Update(0.25);
+    ASSERT_TRUE(fleet.current_Battery[id] == 25.0 && manager.is_Charging(id), "\tLater updates should leave an unfinished vehicle untouched");
+
+    manager.sync();
+    ASSERT_TRUE(fleet.current_Battery[id] == 75.0, "\tSyncing should bring the battery up to the clock");
+
+    manager.charge_Update(0.25);
+    ASSERT_TRUE(!manager.is_Charging(id) && fleet.current_Battery[id] == 100.0, "\tThe vehicle should finish on the fourth update");
+    ASSERT_TRUE(abs(fleet.total_chargingTime[id] - 1.0) < 1e-12 && stats.StatList[0].charge_count == 1,
+                "\tThe session should count one hour of charging and one charge");
+}
+
+/**
+ * @brief Tests that vehicles with different charge times each finish on the step they become full.
+ */
+void test_CompletionsFollowChargeTime() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargerManager manager(stats, fleet, 1000);
+    for (int t = 0; t < 10; ++t)
+    {
+        Vehicle v("Type" + to_string(t), 100, 100, 0.1 * (t + 1), 1, 4, 0.0);
+        stats.register_Type(t, v.name);
+        fleet.add(t, v, 100);
+    }
+    for (size_t i = 0; i < fleet.size(); ++i)
+    {
+        fleet.current_Battery[i] = 0.0;
+        manager.charge_Request(static_cast<int>(i));
+    }
 
-    delete vi;
+    bool onTime = true;
+    for (int step = 1; step <= 10; ++step)
+    {
+        manager.charge_Update(0.1);
+        for (size_t i = 0; i < fleet.size(); ++i)
+        {
+            bool finished = fleet.type_Id[i] < step;        // Type t needs t + 1 steps
+            onTime = onTime && manager.is_Charging(static_cast<int>(i)) != finished;
+        }
+    }
+    ASSERT_TRUE(onTime, "\tEach vehicle should leave its charger on the step it becomes full");
+    ASSERT_TRUE(stats.StatList[9].charge_count == 100 && fleet.current_Battery[999] == 100.0, "\tEvery charge should be logged");
 }
 
 /**
@@ -145,6 +335,13 @@ int main() {
     test_PromotionFrom_Queue();
     test_NoOverfill_BeyondCapacity();
     test_DuplicateChargeRequest_Ignored();
+    test_ReleasePromotesQueuedVehicle();
+    test_BatchedRequest_KeepsOrder();
+    test_StateStoredOnFleet();
+    test_QueueWrapsAround();
+    test_QueueWaitLogged();
+    test_LazyChargingCompletesOnTime();
+    test_CompletionsFollowChargeTime();
     cout << "\n--- All ChargerManager Tests Completed ---" << endl;
     return 0;
 }
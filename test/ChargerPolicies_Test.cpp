@@ -0,0 +1,289 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cstdio>
+
+#include "Vehicle.h"
+#include "VehicleFleet.h"
+#include "ChargerManager.h"
+#include "ChargerPolicies.h"
+#include "IndexedHeap.h"
+#include "Statistics.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Tests that the heap pops keys in order, ties in insertion order, after updates and removals.
+ */
+void test_IndexedHeapOrder() {
+    IndexedHeap<4> heap;
+    mt19937 gen(7);
+    uniform_int_distribution<int> keys(0, 50);
+    vector<double> key(2000);
+
+    for (int id = 0; id < 2000; ++id)
+    {
+        key[id] = keys(gen);
+        heap.push(id, key[id]);
+    }
+    for (int id = 0; id < 2000; id += 3)
+    {
+        key[id] = keys(gen);
+        heap.update(id, key[id]);
+    }
+    for (int id = 1; id < 2000; id += 5)
+    {
+        heap.remove(id);
+    }
+
+    bool ordered = true;
+    size_t popped = 0;
+    double last = -1.0;
+    while (!heap.empty())
+    {
+        double k = heap.top_Key();
+        int id = heap.pop();
+        ordered = ordered && k >= last && k == key[id] && id % 5 != 1;
+        last = k;
+        popped++;
+    }
+
+    ASSERT_TRUE(ordered, "\tHeap should pop the smallest key first and skip removed ids");
+    ASSERT_TRUE(popped == 2000 - 400, "\tHeap should hold every id pushed and not removed");
+
+    IndexedHeap<2> ties;
+    ties.push(5, 1.0);
+    ties.push(3, 1.0);
+    ties.push(9, 1.0);
+    ASSERT_TRUE(ties.pop() == 5 && ties.pop() == 3 && ties.pop() == 9, "\tEqual keys should leave in insertion order");
+}
+
+/**
+ * @brief Fills a one-charger manager, queues vehicles with different batteries and returns the promotion order.
+ * 
+ * Vehicle 0 holds the charger; vehicles 1 to 3 queue in id order with the given battery levels.
+ */
+template <class Manager>
+vector<int> promotion_Order(Manager &manager, VehicleFleet &fleet, const vector<double> &battery) {
+    for (size_t i = 0; i < battery.size(); ++i)
+    {
+        fleet.current_Battery[i + 1] = battery[i];
+    }
+
+    manager.charge_Request(0);
+    for (size_t i = 0; i < battery.size(); ++i)
+    {
+        manager.charge_Request(static_cast<int>(i + 1));
+    }
+
+    vector<int> order;
+    int holder = 0;
+    while ((holder = manager.charge_Release(holder)) >= 0)
+    {
+        order.push_back(holder);
+    }
+    return order;
+}
+
+/**
+ * @brief Tests that FIFO keeps arrival order and the heap policies order by vehicle state.
+ */
+void test_PolicyOrder() {
+    Vehicle slow("Slow", 100, 100, 1.0, 1, 4, 0.0);
+    Vehicle fast("Fast", 100, 100, 0.2, 1, 4, 0.0);
+
+    {
+        Statistics stats;
+        VehicleFleet fleet;
+        ChargerManager manager(stats, fleet, 1);
+        stats.register_Type(0, slow.name);
+        fleet.add(0, slow, 4);
+        ASSERT_TRUE(promotion_Order(manager, fleet, {50, 10, 90}) == vector<int>({1, 2, 3}), "\tFIFO should promote in arrival order");
+    }
+    {
+        Statistics stats;
+        VehicleFleet fleet;
+        LowestBatteryManager manager(stats, fleet, 1);
+        stats.register_Type(0, slow.name);
+        fleet.add(0, slow, 4);
+        ASSERT_TRUE(promotion_Order(manager, fleet, {50, 10, 90}) == vector<int>({2, 1, 3}), "\tLowest battery should be promoted first");
+    }
+    {
+        Statistics stats;
+        VehicleFleet fleet;
+        ShortestChargeManager manager(stats, fleet, 1);
+        stats.register_Type(0, slow.name);
+        stats.register_Type(1, fast.name);
+        fleet.add(0, slow, 3);
+        fleet.add(1, fast);                                 // Needs a fifth of the charge time of the others
+        ASSERT_TRUE(promotion_Order(manager, fleet, {0, 50, 0}) == vector<int>({3, 2, 1}), "\tShortest remaining charge should be promoted first");
+    }
+}
+
+/**
+ * @brief Tests that weighted fair queueing shares the charger between types by weight.
+ * 
+ * Type 0 is given three times the weight of type 1, so while both have vehicles waiting
+ * about three type 0 vehicles are served for each type 1 vehicle.
+ */
+void test_WeightedFairShare() {
+    Statistics stats;
+    VehicleFleet fleet;
+    WeightedFairManager manager(stats, fleet, 1);
+    manager.get_Queue().get_Priority().set_Weight(0, 3.0);
+    Vehicle v("TestVehicle", 100, 100, 1.0, 1, 4, 0.0);
+    stats.register_Type(0, "TypeA");
+    stats.register_Type(1, "TypeB");
+    int holder = fleet.add(0, v);
+    int first0 = fleet.add(0, v, 40);
+    int first1 = fleet.add(1, v, 40);
+    for (int i = holder; i < first1 + 40; ++i)
+    {
+        fleet.current_Battery[i] = 0.0;
+    }
+
+    manager.charge_Request(holder);
+    for (int i = 0; i < 40; ++i)                            // Type 1 arrives first and would win under FIFO
+        manager.charge_Request(first1 + i);
+    for (int i = 0; i < 40; ++i)
+        manager.charge_Request(first0 + i);
+
+    int served0 = 0, served1 = 0;
+    for (int i = 0; i < 40; ++i)
+    {
+        holder = manager.charge_Release(holder);
+        (fleet.type_Id[holder] == 0 ? served0 : served1)++;
+    }
+
+    ASSERT_TRUE(served0 == 30 && served1 == 10, "\tTypes should share the charger 3:1 by weight");
+}
+
+/**
+ * @brief Tests a deep queue and a priority update in a heap-based manager.
+ * 
+ * 100000 vehicles wait for one charger; raising the battery of the emptiest one moves it to the back.
+ */
+void test_DeepQueueReprioritize() {
+    Statistics stats;
+    VehicleFleet fleet;
+    LowestBatteryManager manager(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1.0, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int count = 100000;
+    fleet.add(0, v, count + 1);
+    for (int i = 1; i <= count; ++i)
+    {
+        fleet.current_Battery[i] = (i * 7919) % count * 100.0 / count;
+    }
+
+    vector<int> ids(count + 1);
+    for (int i = 0; i <= count; ++i)
+        ids[i] = i;
+    manager.charge_Request(ids.data(), ids.size());
+
+    int emptiest = 1;
+    for (int i = 1; i <= count; ++i)
+    {
+        if (fleet.current_Battery[i] < fleet.current_Battery[emptiest])
+            emptiest = i;
+    }
+    fleet.current_Battery[emptiest] = 100.0;
+    manager.reprioritize(emptiest);
+
+    bool ordered = true;
+    double last = -1.0;
+    int holder = 0;
+    int promoted = 0;
+    while ((holder = manager.charge_Release(holder)) >= 0)
+    {
+        ordered = ordered && fleet.current_Battery[holder] >= last;
+        last = fleet.current_Battery[holder];
+        promoted++;
+    }
+
+    ASSERT_TRUE(promoted == count, "\tEvery queued vehicle should be promoted once");
+    ASSERT_TRUE(ordered && last == 100.0, "\tDeep queue should promote by battery, honouring the priority update");
+}
+
+/**
+ * @brief Returns the order in which a single-charger manager serves every vehicle it holds.
+ */
+template <class Manager>
+vector<int> service_Order(Manager &manager, VehicleFleet &fleet) {
+    vector<int> order;
+    for (size_t step = 0; step < fleet.size(); ++step)
+    {
+        for (size_t id = 0; id < fleet.size(); ++id)
+        {
+            if (fleet.charge_State[id] == ChargeState::Charging)
+                order.push_back(static_cast<int>(id));
+        }
+        manager.charge_Update(10.0);
+    }
+    return order;
+}
+
+/**
+ * @brief Tests that a priority queue saved to a checkpoint serves vehicles in the same order after loading.
+ */
+void test_QueueCheckpoint() {
+    Vehicle v("Test", 100, 100, 1.0, 1, 4, 0.0);
+    vector<double> levels = {0, 40, 10, 70, 10, 30};
+
+    Statistics stats;
+    VehicleFleet fleet;
+    LowestBatteryManager manager(stats, fleet, 1);
+    stats.register_Type(0, v.name);
+    fleet.add(0, v, levels.size());
+    for (size_t id = 0; id < levels.size(); ++id)
+    {
+        fleet.current_Battery[id] = levels[id];
+        manager.charge_Request(static_cast<int>(id));
+    }
+
+    CheckpointWriter out;
+    fleet.save(out);
+    manager.save(out);
+    out.save("policy_checkpoint.bin");
+
+    VehicleFleet restored_Fleet;
+    LowestBatteryManager restored(stats, restored_Fleet, 3);
+    CheckpointReader in;
+    bool loaded = in.open("policy_checkpoint.bin") && restored_Fleet.load(in, 1) && restored.load(in) && in.at_End();
+
+    ASSERT_TRUE(loaded && restored.queue_Length() == 5 && restored.is_Charging(0), "\tQueue and charger slot should be restored");
+    ASSERT_TRUE(service_Order(restored, restored_Fleet) == service_Order(manager, fleet), "\tRestored queue should serve vehicles in the same order");
+    remove("policy_checkpoint.bin");
+}
+
+/**
+ * @brief Main function to run all charger queue policy unit tests.
+ * 
+ * Executes all defined tests and prints their results to the console.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- ChargerPolicies Unit Tests ---\n" << endl;
+    test_IndexedHeapOrder();
+    test_PolicyOrder();
+    test_WeightedFairShare();
+    test_DeepQueueReprioritize();
+    test_QueueCheckpoint();
+    cout << "\n--- All ChargerPolicies Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <vector>
+
+#include "Vehicle.h"
+#include "VehicleFleet.h"
+#include "ChargingNetwork.h"
+#include "Statistics.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Tests that the default network is a single site shared by every vehicle.
+ * 
+ * Ensures it queues vehicles once its chargers are full, like one ChargerManager.
+ */
+void test_DefaultSingleSite() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargingNetwork network(stats, fleet, 1);
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int first = fleet.add(0, v, 2);
+
+    network.charge_Request(first);
+    network.charge_Request(first + 1);
+
+    ASSERT_TRUE(network.site_Count() == 1, "\tDefault network should have one site");
+    ASSERT_TRUE(network.is_Charging(first) && network.is_Waiting(first + 1), "\tSecond vehicle should wait for the only charger");
+}
+
+/**
+ * @brief Tests that vehicles only use the chargers of their home site.
+ * 
+ * A full site queues its vehicles even while another site has free chargers.
+ */
+void test_HomeSitesAreIndependent() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargingNetwork network(stats, fleet);
+    network.set_Sites({1, 1});
+    Vehicle v("TestVehicle", 100, 100, 1, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int first = fleet.add(0, v, 3);
+    network.set_HomeSite(first, 0);
+    network.set_HomeSite(first + 1, 0);
+    network.set_HomeSite(first + 2, 1);
+
+    vector<int> ids = {first, first + 1, first + 2};
+    network.charge_Request(ids.data(), ids.size());
+
+    ASSERT_TRUE(network.is_Waiting(first + 1) && network.is_Charging(first + 2), "\tFull site should queue while another site charges");
+    ASSERT_TRUE(network.site(0).queue_Length() == 1 && network.site(1).queue_Length() == 0, "\tQueues should be kept per site");
+    ASSERT_TRUE(network.charge_Release(first) == first + 1, "\tReleasing a charger should promote from the same site");
+}
+
+/**
+ * @brief Tests that vehicles without a home site are spread over the sites by id.
+ */
+void test_DefaultHomeSite() {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargingNetwork network(stats, fleet);
+    network.set_Sites({2, 2, 2});
+
+    ASSERT_TRUE(network.site_Of(0) == 0 && network.site_Of(4) == 1 && network.site_Of(8) == 2, "\tDefault home site should be id modulo the site count");
+}
+
+/**
+ * @brief Runs a network of many sites and returns its merged charge statistics.
+ * 
+ * @param threads Threads the network may use for its update.
+ * @return Stats Totals of the single vehicle type.
+ */
+Stats run_Network(size_t threads) {
+    Statistics stats;
+    VehicleFleet fleet;
+    ChargingNetwork network(stats, fleet);
+    network.set_Sites(vector<int>(64, 2));
+    network.set_Threads(threads);
+    Vehicle v("TestVehicle", 100, 100, 0.3, 1, 4, 0.0);
+    stats.register_Type(0, v.name);
+    int first = fleet.add(0, v, 1000);
+
+    for (int step = 0; step < 20; ++step)
+    {
+        for (int i = first; i < first + 1000; ++i)
+        {
+            if (fleet.charge_State[i] == ChargeState::Idle && (i + step) % 7 == 0)
+            {
+                fleet.current_Battery[i] = 0.0;
+                network.charge_Request(i);
+            }
+        }
+        network.charge_Update(0.1);
+    }
+    return stats.StatList[0];
+}
+
+/**
+ * @brief Tests that updating the sites in parallel gives the same statistics as a serial update.
+ */
+void test_ParallelUpdateMatchesSerial() {
+    Stats serial = run_Network(1);
+    Stats parallel = run_Network(4);
+
+    ASSERT_TRUE(serial.charge_count > 0, "\tSites should complete charges");
+    ASSERT_TRUE(serial.charge_count == parallel.charge_count && serial.total_ChargingTime == parallel.total_ChargingTime,
+                "\tParallel update should match the serial update exactly");
+}
+
+/**
+ * @brief Main function to run all ChargingNetwork related unit tests.
+ * 
+ * Executes all defined tests and prints their results to the console.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- ChargingNetwork Unit Tests ---\n" << endl;
+    test_DefaultSingleSite();
+    test_HomeSitesAreIndependent();
+    test_DefaultHomeSite();
+    test_ParallelUpdateMatchesSerial();
+    cout << "\n--- All ChargingNetwork Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
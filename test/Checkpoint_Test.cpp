@@ -0,0 +1,320 @@
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdio>
+#include <cstddef>
+#include <limits>
+
+#include "Simulation.h"
+#include "FleetManifest.h"
+#include "ReplicationRunner.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Sets up a seeded simulation of 200 vehicles over 4 sites of 2 chargers, so queues form.
+ */
+void setup(Simulation &sim) {
+    FleetManifest manifest;
+    manifest.parse("type,Alpha,120,320,0.6,1.6,4,0.25\n"
+                   "type,Echo,30,150,0.3,5.8,2,0.61\n"
+                   "fleet,Alpha,120\n"
+                   "fleet,Echo,80\n");
+    sim.set_Seed(5);
+    sim.set_PrintSummary(false);
+    sim.set_FaultLogPath("");
+    sim.vehicle_Init(manifest);
+    sim.get_Chargers().set_Sites(vector<int>(4, 2));
+}
+
+/**
+ * @brief Checks that two simulations hold the same statistics and fleet state.
+ */
+bool same_State(Simulation &a, Simulation &b) {
+    const vector<Stats> &x = a.getStats().StatList;
+    const vector<Stats> &y = b.getStats().StatList;
+    bool same = x.size() == y.size() && a.get_CurrentTime() == b.get_CurrentTime();
+    for (size_t i = 0; same && i < x.size(); ++i)
+    {
+        same = x[i].total_FlightTime == y[i].total_FlightTime && x[i].total_Faults == y[i].total_Faults &&
+               x[i].flight_count == y[i].flight_count && x[i].charge_count == y[i].charge_count &&
+               x[i].total_ChargingTime == y[i].total_ChargingTime &&
+               x[i].queue_Wait.count() == y[i].queue_Wait.count() && x[i].queue_Wait.quantile(0.95) == y[i].queue_Wait.quantile(0.95);
+    }
+    VehicleFleet &f = a.get_Fleet(), &g = b.get_Fleet();
+    return same && f.current_Battery == g.current_Battery && f.rng_Counter == g.rng_Counter &&
+           f.fault_Count == g.fault_Count && f.charge_State == g.charge_State;
+}
+
+/**
+ * @brief Tests that successive partial runs continue the charger queues instead of clearing them.
+ */
+void test_PartialRunsContinue() {
+    Simulation whole, pieces;
+    setup(whole);
+    setup(pieces);
+
+    whole.run_Sim();
+    pieces.run_PartialSimulation(1.5);
+    pieces.run_PartialSimulation(1.5);
+
+    ASSERT_TRUE(same_State(whole, pieces), "\tTwo partial runs should match one full run");
+}
+
+/**
+ * @brief Tests that a run restored from a mid-run checkpoint ends exactly like a run straight through.
+ */
+void test_RestoreMatchesStraightRun() {
+    Simulation whole, first, restored;
+    setup(whole);
+    setup(first);
+    restored.set_PrintSummary(false);
+    restored.set_FaultLogPath("");
+
+    whole.run_Sim();
+    first.run_PartialSimulation(1.5);
+    bool saved = first.save_Checkpoint("checkpoint_test.bin");
+    bool loaded = restored.load_Checkpoint("checkpoint_test.bin");
+
+    ASSERT_TRUE(saved && loaded, "\tCheckpoint should be written and read back");
+    ASSERT_TRUE(restored.get_VehicleCount() == 200 && restored.get_Chargers().site_Count() == 4, "\tFleet and sites should be restored");
+    ASSERT_TRUE(restored.get_Chargers().queue_Length() == first.get_Chargers().queue_Length() &&
+                restored.get_Chargers().queue_Length() > 0, "\tCharger queues should be restored");
+    ASSERT_TRUE(same_State(first, restored), "\tRestored state should equal the saved one");
+
+    restored.run_Sim();
+    ASSERT_TRUE(same_State(whole, restored), "\tRestored run should finish exactly like a run straight through");
+    remove("checkpoint_test.bin");
+}
+
+/**
+ * @brief Tests that files which are not complete checkpoints are rejected.
+ */
+void test_RejectsDamagedFiles() {
+    Simulation sim;
+    setup(sim);
+    sim.run_PartialSimulation(1.0);
+    sim.save_Checkpoint("checkpoint_test.bin");
+
+    {
+        ofstream("checkpoint_junk.bin") << "not a checkpoint";
+    }
+    Simulation untouched;
+    setup(untouched);
+    ASSERT_TRUE(!untouched.load_Checkpoint("checkpoint_junk.bin") && untouched.get_VehicleCount() == 200,
+                "\tA file that is not a checkpoint should leave the simulation untouched");
+
+    ifstream in("checkpoint_test.bin", ios::binary);
+    string bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    in.close();
+    {
+        ofstream out("checkpoint_test.bin", ios::binary | ios::trunc);
+        out.write(bytes.data(), bytes.size() - 1);
+    }
+    ASSERT_TRUE(!untouched.load_Checkpoint("checkpoint_test.bin") && untouched.get_VehicleCount() == 200,
+                "\tA truncated checkpoint should be rejected by its header");
+
+    uint64_t body = bytes.size() / 2 - sizeof(CheckpointHeader);
+    bytes.resize(bytes.size() / 2);
+    bytes.replace(offsetof(CheckpointHeader, body_Bytes), sizeof(body), reinterpret_cast<const char*>(&body), sizeof(body));
+    {
+        ofstream out("checkpoint_test.bin", ios::binary | ios::trunc);
+        out.write(bytes.data(), bytes.size());
+    }
+    ASSERT_TRUE(!untouched.load_Checkpoint("checkpoint_test.bin") && untouched.get_VehicleCount() == 0,
+                "\tA checkpoint cut short inside its state should be rejected and leave no vehicles");
+
+    remove("checkpoint_test.bin");
+    remove("checkpoint_junk.bin");
+}
+
+/**
+ * @brief Tests that states which read back cleanly but could not be run are rejected.
+ */
+void test_RejectsCorruptedState() {
+    Simulation warm;
+    setup(warm);
+    warm.run_PartialSimulation(1.0);
+    Simulation sim;
+
+    warm.get_Fleet().type_Id[7] = numeric_limits<int>::max();
+    ASSERT_TRUE(!sim.restore(warm.snapshot()) && sim.get_VehicleCount() == 0,
+                "\tA huge vehicle type should be rejected without allocating for it");
+
+    warm.get_Fleet().type_Id[7] = static_cast<int>(warm.getStats().StatList.size());
+    ASSERT_TRUE(!sim.restore(warm.snapshot()) && sim.get_VehicleCount() == 0,
+                "\tA vehicle type past the registered types should be rejected");
+
+    warm.get_Fleet().type_Id[7] = 0;
+    warm.set_TimeIncrement(0);
+    ASSERT_TRUE(!sim.restore(warm.snapshot()) && sim.get_TimeIncrement() == 0.5,
+                "\tA zero tick should be rejected and leave the clock as it was");
+
+    warm.set_TimeIncrement(0.5);
+    ASSERT_TRUE(sim.restore(warm.snapshot()) && sim.get_VehicleCount() == 200, "\tThe repaired state should restore");
+}
+
+/**
+ * @brief Tests that a checkpoint whose fleet charger states disagree with the sites is rejected.
+ *
+ * Each case damages the warm state in one way, checks the snapshot is refused and repairs it.
+ */
+void test_RejectsInconsistentChargers() {
+    Simulation warm;
+    setup(warm);
+    warm.run_PartialSimulation(1.0);
+    VehicleFleet &fleet = warm.get_Fleet();
+    ChargingNetwork &chargers = warm.get_Chargers();
+    Simulation sim;
+
+    int idle = -1, queued = -1;
+    for (int id = 0; id < warm.get_VehicleCount(); ++id)
+    {
+        if (idle < 0 && fleet.charge_State[id] == ChargeState::Idle)
+            idle = id;
+        if (queued < 0 && fleet.charge_State[id] == ChargeState::Queued)
+            queued = id;
+    }
+    ASSERT_TRUE(idle >= 0 && queued >= 0, "\tThe warm state should hold idle and queued vehicles");
+    if (idle < 0 || queued < 0)
+        return;
+
+    fleet.charge_State[idle] = ChargeState::Charging;
+    fleet.charger_Slot[idle] = 7;
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tA charging vehicle on no charger should be rejected");
+
+    fleet.charge_State[idle] = static_cast<ChargeState>(3);
+    fleet.charger_Slot[idle] = -1;
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tAn unknown charger state should be rejected");
+
+    fleet.charge_State[idle] = ChargeState::Idle;
+    fleet.charger_Slot[idle] = 0;
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tAn idle vehicle holding a charger slot should be rejected");
+
+    fleet.charger_Slot[idle] = -1;
+    fleet.charge_State[idle] = ChargeState::Queued;
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tA queued vehicle missing from its queue should be rejected");
+
+    fleet.charge_State[idle] = ChargeState::Idle;
+    fleet.charge_State[queued] = ChargeState::Idle;
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tAn idle vehicle left in a queue should be rejected");
+
+    fleet.charge_State[queued] = ChargeState::Queued;
+    ASSERT_TRUE(sim.restore(warm.snapshot()) && sim.get_VehicleCount() == 200, "\tThe repaired state should restore");
+
+    int home = chargers.site_Of(queued);
+    fleet.charge_State[queued] = ChargeState::Idle;                  // Home sites can only change while idle
+    chargers.set_HomeSite(queued, (home + 1) % static_cast<int>(chargers.site_Count()));
+    fleet.charge_State[queued] = ChargeState::Queued;
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tA vehicle queued away from its home site should be rejected");
+
+    fleet.charge_State[queued] = ChargeState::Idle;
+    chargers.set_HomeSite(queued, home);
+    chargers.charge_Request(queued);                                 // Every charger at its site is busy, so it queues a second time
+    ASSERT_TRUE(!sim.restore(warm.snapshot()), "\tA vehicle queued twice should be rejected");
+}
+
+/**
+ * @brief Tests that forks of a warm state run independently and reproducibly on their own substreams.
+ */
+void test_ForkBranches() {
+    Simulation warm, control;
+    setup(warm);
+    setup(control);
+    warm.run_PartialSimulation(1.0);
+    control.run_PartialSimulation(1.0);
+
+    unique_ptr<Simulation> a = warm.fork(1), b = warm.fork(1), c = warm.fork(2);
+    ASSERT_TRUE(a->get_VehicleCount() == 200 && a->get_CurrentTime() == 1.0 &&
+                a->get_Chargers().queue_Length() == warm.get_Chargers().queue_Length(), "\tA fork should start from the warm state");
+
+    a->run_Sim();
+    b->run_Sim();
+    c->run_Sim();
+    ASSERT_TRUE(same_State(*a, *b), "\tForks with the same branch id should run identically");
+    ASSERT_TRUE(a->get_Fleet().fault_Count != c->get_Fleet().fault_Count, "\tForks with different branch ids should draw different faults");
+    ASSERT_TRUE(same_State(warm, control), "\tRunning the forks should leave the warm state untouched");
+
+    vector<unique_ptr<Simulation>> shared = warm.fork(1, 2);
+    bool made = shared.size() == 2 && shared[0] && shared[1];
+    ASSERT_TRUE(made, "\tForking several branches should return one simulation per branch");
+    if (made)
+    {
+        shared[0]->run_Sim();
+        shared[1]->run_Sim();
+        ASSERT_TRUE(same_State(*shared[0], *a) && same_State(*shared[1], *c), "\tForks sharing one snapshot should match forks taken one at a time");
+    }
+}
+
+/**
+ * @brief Tests that branches restored from one snapshot in parallel match forks run one at a time.
+ */
+void test_ParallelBranchesFromSnapshot() {
+    Simulation warm;
+    setup(warm);
+    warm.run_PartialSimulation(1.0);
+    const vector<char> image = warm.snapshot();
+
+    ReplicationRunner runner(16, 4);
+    runner.set_Setup([&image](Simulation &sim, int r) {
+        sim.restore(image);
+        sim.set_Branch(static_cast<uint32_t>(r) + 1);
+    });
+    runner.run();
+
+    bool same = runner.get_Results().size() == 16;
+    for (int r = 0; same && r < 16; ++r)
+    {
+        unique_ptr<Simulation> branch = warm.fork(static_cast<uint32_t>(r) + 1);
+        branch->run_Sim();
+
+        const vector<Stats> &x = runner.get_Results()[r].StatList;
+        const vector<Stats> &y = branch->getStats().StatList;
+        for (size_t i = 0; same && i < x.size(); ++i)
+        {
+            same = x[i].total_Faults == y[i].total_Faults && x[i].total_FlightTime == y[i].total_FlightTime &&
+                   x[i].charge_count == y[i].charge_count;
+        }
+    }
+    ASSERT_TRUE(same, "\tBranches restored from one snapshot on 4 threads should match forks run serially");
+
+    vector<char> damaged(image.begin(), image.begin() + image.size() / 2);
+    Simulation sim;
+    ASSERT_TRUE(!sim.restore(damaged), "\tA truncated snapshot should be rejected");
+}
+
+/**
+ * @brief Main function to run all checkpoint related unit tests.
+ * 
+ * Executes all defined tests and prints their results to the console.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- Checkpoint Unit Tests ---\n" << endl;
+    test_PartialRunsContinue();
+    test_RestoreMatchesStraightRun();
+    test_RejectsDamagedFiles();
+    test_RejectsCorruptedState();
+    test_RejectsInconsistentChargers();
+    test_ForkBranches();
+    test_ParallelBranchesFromSnapshot();
+    cout << "\n--- All Checkpoint Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <iostream>
+
+#include "CounterRng.h"
+#include "VehicleFleet.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL" << message << endl; \
+    } else { \
+        cout << "PASS" << message << endl; \
+    } \
+
+/**
+ * @brief Checks the generator against the published Philox4x32-10 known-answer vectors.
+ */
+void test_PhiloxKnownAnswers() {
+    array<uint32_t, 4> zero = CounterRng::philox({0, 0, 0, 0}, {0, 0});
+    array<uint32_t, 4> pi = CounterRng::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+
+    ASSERT_TRUE(zero == (array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}), "\tZero counter and key should match the reference output");
+    ASSERT_TRUE(pi == (array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}), "\tDigits-of-pi counter and key should match the reference output");
+}
+
+/**
+ * @brief Verifies uniform draws stay in [0, 1) and average close to one half.
+ */
+void test_UniformRange() {
+    bool inRange = true;
+    double sum = 0.0;
+    int n = 100000;
+
+    for (int i = 0; i < n; ++i)
+    {
+        double u = CounterRng::uniform(42, 0, 7, i);
+        inRange = inRange && u >= 0.0 && u < 1.0;
+        sum += u;
+    }
+
+    ASSERT_TRUE(inRange, "\tDraws should lie in [0, 1)");
+    ASSERT_TRUE(sum / n > 0.49 && sum / n < 0.51, "\tMean of draws should be close to 0.5");
+}
+
+/**
+ * @brief Verifies a vehicle's stream depends only on the seed and its id, not on other vehicles.
+ */
+void test_FleetStreamsReproducible() {
+    Vehicle v("Stream", 100.0, 100.0, 1.0, 1.0, 4, 1.0);
+    VehicleFleet a, b;
+    a.set_Seed(1234, 3);
+    b.set_Seed(1234, 3);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        a.add(0, v);
+        b.add(0, v);
+    }
+
+    // a draws vehicle 0 heavily before vehicle 2; b only draws vehicle 2
+    for (int i = 0; i < 50; ++i)
+        a.draw_Uniform(0);
+
+    bool same = true;
+    for (int i = 0; i < 10; ++i)
+        same = same && a.draw_Uniform(2) == b.draw_Uniform(2);
+
+    VehicleFleet other;
+    other.set_Seed(1234, 4);
+    other.add(0, v);
+
+    ASSERT_TRUE(same, "\tA vehicle's draws should not depend on other vehicles");
+    ASSERT_TRUE(other.draw_Uniform(0) != b.draw_Uniform(0), "\tDifferent replicas should get different streams");
+}
+
+/**
+ * @brief Entry point to run all CounterRng related unit tests.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- Running CounterRng Unit Tests ---" << endl;
+    test_PhiloxKnownAnswers();
+    test_UniformRange();
+    test_FleetStreamsReproducible();
+    cout << "--- All CounterRng Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
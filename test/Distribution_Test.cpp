@@ -0,0 +1,158 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cmath>
+
+#include "Distribution.h"
+#include "Statistics.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Tests that mean and variance match a two-pass computation.
+ */
+void test_WelfordMatchesTwoPass() {
+    Distribution d;
+    vector<double> values;
+    mt19937 gen(1);
+    normal_distribution<double> normal(5.0, 2.0);
+    for (int i = 0; i < 10000; ++i)
+    {
+        values.push_back(normal(gen));
+        d.add(values.back());
+    }
+
+    double mean = 0.0;
+    for (double v : values) mean += v;
+    mean /= values.size();
+    double var = 0.0;
+    for (double v : values) var += (v - mean) * (v - mean);
+    var /= values.size() - 1;
+
+    ASSERT_TRUE(fabs(d.mean() - mean) < 1e-9 && fabs(d.variance() - var) < 1e-9, "\tWelford mean and variance should match two passes");
+    ASSERT_TRUE(d.min() == *min_element(values.begin(), values.end()) && d.max() == *max_element(values.begin(), values.end()),
+                "\tMinimum and maximum should be exact");
+}
+
+/**
+ * @brief Tests that sketch quantiles are within the 1% relative accuracy of the exact ones.
+ */
+void test_QuantileAccuracy() {
+    Distribution d;
+    vector<double> values;
+    mt19937 gen(2);
+    lognormal_distribution<double> lognormal(0.0, 1.5);
+    for (int i = 0; i < 100000; ++i)
+    {
+        values.push_back(lognormal(gen));
+        d.add(values.back());
+    }
+    sort(values.begin(), values.end());
+
+    bool accurate = true;
+    for (double q : {0.01, 0.25, 0.5, 0.9, 0.95, 0.99, 0.999})
+    {
+        double exact = values[static_cast<size_t>(q * (values.size() - 1))];
+        accurate = accurate && fabs(d.quantile(q) - exact) <= 0.0101 * exact;
+    }
+
+    ASSERT_TRUE(accurate, "\tQuantiles should be within 1% of the exact values");
+    ASSERT_TRUE(d.get_Sketch().bucket_Count() < 2048, "\tSketch memory should not grow with the number of values");
+
+    ostringstream expected;
+    expected << d.quantile(0.50) << " / " << d.quantile(0.95) << " / " << d.quantile(0.99);
+    ASSERT_TRUE(d.percentiles() == expected.str(), "\tThe report should list the p50, p95 and p99");
+}
+
+/**
+ * @brief Tests that merging sketches gives exactly the sketch of all the values.
+ */
+void test_MergeIsExact() {
+    Distribution all, left, right;
+    mt19937 gen(3);
+    exponential_distribution<double> exponential(2.0);
+    for (int i = 0; i < 50000; ++i)
+    {
+        double v = exponential(gen);
+        all.add(v);
+        (i % 3 == 0 ? left : right).add(v);
+    }
+    left.merge(right);
+
+    bool same = left.count() == all.count();
+    for (double q = 0.0; q <= 1.0; q += 0.01)
+    {
+        same = same && left.quantile(q) == all.quantile(q);
+    }
+
+    ASSERT_TRUE(same, "\tMerged sketch should give the same quantiles as one sketch of every value");
+    ASSERT_TRUE(fabs(left.variance() - all.variance()) < 1e-9, "\tMerged variance should match");
+}
+
+/**
+ * @brief Tests that a huge range of values stays within the bucket limit.
+ * 
+ * Folding the lowest buckets must keep the upper quantiles accurate.
+ */
+void test_BoundedBuckets() {
+    QuantileSketch sketch;
+    for (int e = -300; e <= 300; ++e)
+    {
+        sketch.add(pow(10.0, e));
+    }
+
+    ASSERT_TRUE(sketch.bucket_Count() <= 2048, "\tSketch should never hold more than its bucket limit");
+    ASSERT_TRUE(fabs(sketch.quantile(1.0) - 1e300) <= 0.0101 * 1e300, "\tTop quantile should survive folding");
+}
+
+/**
+ * @brief Tests that Statistics logs and merges distributions alongside the totals.
+ */
+void test_StatisticsDistributions() {
+    Statistics a, b;
+    a.register_Type(0, "TypeA");
+    b.register_Type(0, "TypeA");
+
+    a.log_Flight(0, 1.0, 100, 2);
+    b.log_Flight(0, 3.0, 300, 2);
+    a.log_Charge(0, 0.5);
+    b.log_Wait(0, 0.25);
+    a.merge(b);
+
+    const Stats &s = a.StatList[0];
+    ASSERT_TRUE(s.flight_count == 2 && s.flight_Time.count() == 2 && s.flight_Time.mean() == 2.0, "\tFlight times should be merged");
+    ASSERT_TRUE(s.charge_Time.count() == 1 && s.queue_Wait.count() == 1 && s.queue_Wait.max() == 0.25, "\tCharge times and waits should be merged");
+}
+
+/**
+ * @brief Main function to run all Distribution related unit tests.
+ * 
+ * Executes all defined tests and prints their results to the console.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- Distribution Unit Tests ---\n" << endl;
+    test_WelfordMatchesTwoPass();
+    test_QuantileAccuracy();
+    test_MergeIsExact();
+    test_BoundedBuckets();
+    test_StatisticsDistributions();
+    cout << "\n--- All Distribution Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
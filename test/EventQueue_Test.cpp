@@ -0,0 +1,76 @@
+#include <iostream>
+
+#include "EventQueue.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL" << message << endl; \
+    } else { \
+        cout << "PASS" << message << endl; \
+    } \
+
+/**
+ * @brief Verifies events come out in time order regardless of push order.
+ */
+void test_PopsInTimeOrder() {
+    EventQueue q;
+
+    q.push(2.0, EventType::Depletion, 0);
+    q.push(0.5, EventType::Fault, 1);
+    q.push(1.0, EventType::ChargeComplete, 2);
+
+    ASSERT_TRUE(q.pop().vehicle == 1, "\tEarliest event should be popped first");
+    ASSERT_TRUE(q.pop().vehicle == 2, "\tSecond earliest event should be popped next");
+    ASSERT_TRUE(q.pop().vehicle == 0, "\tLatest event should be popped last");
+    ASSERT_TRUE(q.empty(), "\tQueue should be empty after popping all events");
+}
+
+/**
+ * @brief Verifies events at the same time keep their insertion order.
+ */
+void test_TiesKeepInsertionOrder() {
+    EventQueue q;
+
+    q.push(1.0, EventType::Depletion, 7);
+    q.push(1.0, EventType::Depletion, 3);
+    q.push(1.0, EventType::Depletion, 5);
+
+    bool ordered = q.pop().vehicle == 7 && q.pop().vehicle == 3 && q.pop().vehicle == 5;
+
+    ASSERT_TRUE(ordered, "\tSimultaneous events should pop in the order they were pushed");
+}
+
+/**
+ * @brief Verifies clear drops every pending event.
+ */
+void test_ClearEmptiesQueue() {
+    EventQueue q;
+
+    q.push(1.0, EventType::Fault, 0);
+    q.push(2.0, EventType::Fault, 1);
+    q.clear();
+
+    ASSERT_TRUE(q.empty() && q.size() == 0, "\tQueue should be empty after clear");
+}
+
+/**
+ * @brief Entry point to run all EventQueue related unit tests.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- Running EventQueue Unit Tests ---" << endl;
+    test_PopsInTimeOrder();
+    test_TiesKeepInsertionOrder();
+    test_ClearEmptiesQueue();
+    cout << "--- All EventQueue Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+
+#include "EventTrace.h"
+#include "TraceReader.h"
+#include "Simulation.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL" << message << endl; \
+    } else { \
+        cout << "PASS" << message << endl; \
+    } \
+
+/**
+ * @brief Counts the events of one kind in a trace.
+ *
+ * @param trace Open trace.
+ * @param kind Kind to count.
+ * @return int Number of matching events.
+ */
+int count_Kind(const TraceReader &trace, TraceKind kind) {
+    int n = 0;
+    for (size_t b = 0; b < trace.block_Count(); ++b)
+    {
+        TraceBlock block = trace.block(b);
+        for (size_t i = 0; i < block.count; ++i)
+            n += block.kind[i] == static_cast<uint8_t>(kind);
+    }
+    return n;
+}
+
+/**
+ * @brief Verifies events written across several blocks read back unchanged.
+ */
+void test_RoundTripAcrossBlocks() {
+    EventTrace writer;
+    writer.open("trace_roundtrip.bin", {"Alpha Company", "Bravo Company"}, 10);
+    for (int i = 0; i < 25; ++i)
+        writer.record(i * 0.25, TraceKind::Fault, i, i % 2, 100.0 - i);
+    writer.close();
+
+    TraceReader reader;
+    bool opened = reader.open("trace_roundtrip.bin");
+
+    bool matches = opened;
+    int seen = 0;
+    for (size_t b = 0; b < reader.block_Count() && matches; ++b)
+    {
+        TraceBlock block = reader.block(b);
+        for (size_t i = 0; i < block.count && matches; ++i, ++seen)
+        {
+            matches = block.time[i] == seen * 0.25 && block.vehicle[i] == seen && block.type[i] == seen % 2 &&
+                      block.value[i] == 100.0 - seen && block.kind[i] == static_cast<uint8_t>(TraceKind::Fault);
+        }
+    }
+
+    ASSERT_TRUE(opened, "\tTrace file should open");
+    ASSERT_TRUE(reader.block_Count() == 3 && reader.event_Count() == 25, "\t25 events in blocks of 10 should fill 3 blocks");
+    ASSERT_TRUE(matches && seen == 25, "\tEvery column should read back what was recorded");
+    ASSERT_TRUE(reader.type_Count() == 2 && reader.type_Name(1) == "Bravo Company", "\tType names should read back by TypeId");
+}
+
+/**
+ * @brief Verifies the block search finds the start of a time window.
+ */
+void test_FindBlockForWindow() {
+    EventTrace writer;
+    writer.open("trace_window.bin", {"Alpha Company"}, 4);
+    for (int i = 0; i < 20; ++i)
+        writer.record(i * 1.0, TraceKind::FlightEnd, i, 0, 1.0);
+    writer.close();
+
+    TraceReader reader;
+    reader.open("trace_window.bin");
+
+    ASSERT_TRUE(reader.find_Block(0.0) == 0, "\tWindow at the start should begin at the first block");
+    ASSERT_TRUE(reader.find_Block(9.5) == 2, "\tTime 9.5 should fall in the block holding events 8 to 11");
+    ASSERT_TRUE(reader.find_Block(100.0) == reader.block_Count(), "\tWindow after the last event should find no block");
+}
+
+/**
+ * @brief Verifies files that are not traces are rejected.
+ */
+void test_RejectsInvalidFile() {
+    ofstream junk("trace_junk.bin", ios::binary);
+    junk << "definitely not a trace file, just some text";
+    junk.close();
+
+    TraceReader reader;
+    ASSERT_TRUE(!reader.open("trace_junk.bin"), "\tFile without the trace header should be rejected");
+    ASSERT_TRUE(!reader.open("trace_missing.bin"), "\tMissing file should be rejected");
+}
+
+/**
+ * @brief Verifies a traced event-driven run records one event per logged flight and fault.
+ */
+void test_EventSimTraceMatchesStats() {
+    Simulation sim;
+    sim.set_Seed(21);
+    sim.set_FaultLogPath("");
+    sim.set_PrintSummary(false);
+    sim.set_TracePath("trace_eventsim.bin");
+    sim.vehicle_Init();
+    sim.run_EventSim();
+
+    int flights = 0, faults = 0;
+    for (const Stats &s : sim.getStats().StatList)
+    {
+        flights += s.flight_count;
+        faults += s.total_Faults;
+    }
+
+    TraceReader reader;
+    reader.open("trace_eventsim.bin");
+
+    bool waits_Valid = true;
+    for (size_t b = 0; b < reader.block_Count(); ++b)
+    {
+        TraceBlock block = reader.block(b);
+        for (size_t i = 0; i < block.count; ++i)
+            if (block.kind[i] == static_cast<uint8_t>(TraceKind::ChargeStart) && block.value[i] < 0.0)
+                waits_Valid = false;
+    }
+
+    ASSERT_TRUE(flights > 0 && count_Kind(reader, TraceKind::FlightEnd) == flights, "\tTrace should hold one FlightEnd per logged flight");
+    ASSERT_TRUE(count_Kind(reader, TraceKind::Fault) == faults, "\tTrace should hold one Fault per logged fault");
+    ASSERT_TRUE(count_Kind(reader, TraceKind::ChargeStart) >= count_Kind(reader, TraceKind::ChargeEnd), "\tEvery ChargeEnd should follow a ChargeStart");
+    ASSERT_TRUE(waits_Valid, "\tQueue waits should never be negative");
+}
+
+/**
+ * @brief Verifies the fixed-step loop traces its flights too.
+ */
+void test_TickSimTraceMatchesStats() {
+    Simulation sim;
+    sim.set_Seed(22);
+    sim.set_FaultLogPath("");
+    sim.set_PrintSummary(false);
+    sim.set_TracePath("trace_ticksim.bin");
+    sim.vehicle_Init();
+    sim.run_Sim();
+
+    int flights = 0;
+    for (const Stats &s : sim.getStats().StatList)
+        flights += s.flight_count;
+
+    TraceReader reader;
+    reader.open("trace_ticksim.bin");
+
+    ASSERT_TRUE(count_Kind(reader, TraceKind::FlightEnd) == flights, "\tTrace should hold one FlightEnd per logged flight");
+    ASSERT_TRUE(count_Kind(reader, TraceKind::ChargeStart) > 0, "\tDepleted vehicles should be traced taking a charger");
+}
+
+/**
+ * @brief Main function to run all EventTrace tests.
+ * 
+ * @return int Returns 0 after all tests complete.
+ */
+int main() {
+    cout << "--- Running EventTrace Unit Tests ---" << endl;
+
+    test_RoundTripAcrossBlocks();
+    test_FindBlockForWindow();
+    test_RejectsInvalidFile();
+    test_EventSimTraceMatchesStats();
+    test_TickSimTraceMatchesStats();
+    cout << "--- All EventTrace Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
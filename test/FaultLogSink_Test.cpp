@@ -0,0 +1,160 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include "FaultLogSink.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL" << message << endl; \
+    } else { \
+        cout << "PASS" << message << endl; \
+    } \
+
+/**
+ * @brief Counts the lines of a text file.
+ *
+ * @param path File to read.
+ * @return int Number of lines.
+ */
+int count_Lines(const string &path) {
+    ifstream in(path);
+    string line;
+    int n = 0;
+    while (getline(in, line))
+        n++;
+    return n;
+}
+
+/**
+ * @brief Verifies a text record matches what the ostream-based fault log used to print.
+ */
+void test_TextMatchesStreamFormat() {
+    FaultLogSink sink;
+    FaultRecord r{1.5, 117.6, 1, 4, 3, 0};
+
+    sink.open("faultSink_text.txt", {"Alpha Company", "Bravo Company"});
+    sink.push(r);
+    sink.close();
+
+    ostringstream expected;
+    expected << "[FAULT] Time: " << r.time
+             << " | Vehicle Type: " << "Bravo Company"
+             << " | Fault Count: " << r.fault_Count
+             << " | Degradation: " << r.cruise_Speed << "\n";
+
+    ifstream in("faultSink_text.txt");
+    stringstream actual;
+    actual << in.rdbuf();
+
+    ASSERT_TRUE(actual.str() == expected.str(), "\tText record should match the stream-formatted line");
+}
+
+/**
+ * @brief Verifies binary records are written unchanged.
+ */
+void test_BinaryRoundTrip() {
+    FaultLogSink sink;
+    sink.set_Format(FaultLogFormat::Binary);
+    sink.open("faultSink_binary.bin", {"Alpha Company"});
+
+    for (int i = 0; i < 100; ++i)
+        sink.push(FaultRecord{i * 0.1, 100.0 - i, 0, i, i + 1, 0});
+    sink.close();
+
+    ifstream in("faultSink_binary.bin", ios::binary);
+    vector<FaultRecord> records(100);
+    in.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(FaultRecord));
+
+    bool ordered = in.gcount() == static_cast<streamsize>(records.size() * sizeof(FaultRecord));
+    for (int i = 0; i < 100 && ordered; ++i)
+        ordered = records[i].vehicle == i && records[i].fault_Count == i + 1;
+
+    ASSERT_TRUE(sizeof(FaultRecord) == 32, "\tFault record should be 32 bytes");
+    ASSERT_TRUE(ordered, "\tBinary records from one thread should be written in push order");
+}
+
+/**
+ * @brief Verifies records pushed from several threads are all written under the blocking policy.
+ *
+ * A tiny ring forces producers to wait on the writer.
+ */
+void test_ConcurrentProducersBlock() {
+    FaultLogSink sink;
+    sink.set_Capacity(8);
+    sink.open("faultSink_threads.txt", {"Alpha Company"});
+
+    vector<thread> producers;
+    for (int t = 0; t < 4; ++t)
+    {
+        producers.emplace_back([&sink, t]() {
+            for (int i = 0; i < 2000; ++i)
+                sink.push(FaultRecord{i * 0.5, 90.0, 0, t, i + 1, 0});
+        });
+    }
+    for (thread &p : producers)
+        p.join();
+
+    sink.flush();
+    ASSERT_TRUE(sink.get_Written() == 8000, "\tFlush should wait until every record is written");
+    sink.close();
+
+    ASSERT_TRUE(sink.get_Dropped() == 0, "\tBlocking policy should never drop records");
+    ASSERT_TRUE(count_Lines("faultSink_threads.txt") == 8000, "\tLog should hold one line per pushed record");
+}
+
+/**
+ * @brief Verifies the drop policy accounts for every record.
+ */
+void test_DropPolicyAccounts() {
+    FaultLogSink sink;
+    sink.set_Capacity(4);
+    sink.set_Backpressure(FaultLogBackpressure::Drop);
+    sink.open("faultSink_drop.txt", {"Alpha Company"});
+
+    for (int i = 0; i < 5000; ++i)
+        sink.push(FaultRecord{0.0, 90.0, 0, 0, i + 1, 0});
+    sink.close();
+
+    ASSERT_TRUE(sink.get_Written() + sink.get_Dropped() == 5000, "\tEvery record should be either written or counted as dropped");
+    ASSERT_TRUE(count_Lines("faultSink_drop.txt") == static_cast<int>(sink.get_Written()), "\tLog should hold exactly the written records");
+}
+
+/**
+ * @brief Verifies records pushed while the sink is closed are ignored.
+ */
+void test_ClosedSinkIgnoresPush() {
+    FaultLogSink sink;
+    sink.push(FaultRecord{0.0, 90.0, 0, 0, 1, 0});
+
+    ASSERT_TRUE(!sink.is_Open(), "\tSink should start closed");
+    ASSERT_TRUE(sink.get_Written() == 0, "\tClosed sink should not write anything");
+}
+
+/**
+ * @brief Main function to run all FaultLogSink tests.
+ * 
+ * @return int Returns 0 after all tests complete.
+ */
+int main() {
+    cout << "--- Running FaultLogSink Unit Tests ---" << endl;
+
+    test_TextMatchesStreamFormat();
+    test_BinaryRoundTrip();
+    test_ConcurrentProducersBlock();
+    test_DropPolicyAccounts();
+    test_ClosedSinkIgnoresPush();
+    cout << "--- All FaultLogSink Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+
+#include "FleetManifest.h"
+#include "Simulation.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL" << message << endl; \
+    } else { \
+        cout << "PASS" << message << endl; \
+    } \
+
+/**
+ * @brief Verifies types, fleet counts and per-vehicle rows are read from CSV.
+ *
+ * Consecutive vehicles of the same type must collapse into one run.
+ */
+void test_CsvTypesAndComposition() {
+    FleetManifest m;
+    bool ok = m.parse(
+        "# comment\n"
+        "type,Alpha Company,120,320,0.6,1.6,4,0.25\r\n"
+        "type, \"Bravo, Inc\" ,100,100,0.2,1.5,5,0.10\n"
+        "\n"
+        "fleet,Alpha Company,3\n"
+        "vehicle,\"Bravo, Inc\"\n"
+        "vehicle,\"Bravo, Inc\"\n"
+        "vehicle,Alpha Company\n");
+
+    ASSERT_TRUE(ok, "\tValid CSV manifest should parse");
+    ASSERT_TRUE(m.types.size() == 2 && m.types[1].name == "Bravo, Inc", "\tQuoted type names may hold commas");
+    ASSERT_TRUE(m.types[0].cruiseSpeed == 120 && m.types[0].passenger_Count == 4 && m.types[0].fault_Probability == 0.25, "\tType parameters should be read in order");
+    ASSERT_TRUE(m.composition.size() == 3, "\tRepeated vehicle rows of one type should merge into one run");
+    ASSERT_TRUE(m.composition[1].type == 1 && m.composition[1].count == 2, "\tRun should keep its type and count");
+    ASSERT_TRUE(m.vehicle_Count() == 6, "\tVehicle count should sum every run");
+}
+
+/**
+ * @brief Verifies the JSON layout, including types referenced before they are defined.
+ */
+void test_JsonManifest() {
+    FleetManifest m;
+    bool ok = m.parse(R"({
+        "version": 2, "notes": {"author": "ops", "tags": ["a", "b\"c"]},
+        "fleet": [{"type": "Echo", "count": 2}],
+        "types": [{"name": "Echo", "cruise_speed": 30, "battery_capacity": 150, "time_to_charge": 0.3,
+                   "energy_per_mile": 5.8, "passenger_count": 2, "fault_probability": 0.61}],
+        "vehicles": ["Echo", {"type": "Echo"}]
+    })");
+
+    ASSERT_TRUE(ok, "\tValid JSON manifest should parse");
+    ASSERT_TRUE(m.types.size() == 1 && m.types[0].energy_PerMile == 5.8, "\tJSON type parameters should be read by key");
+    ASSERT_TRUE(m.composition.size() == 1 && m.vehicle_Count() == 4, "\tFleet and vehicle entries of one type should merge");
+}
+
+/**
+ * @brief Verifies bad manifests are rejected with a message and leave nothing behind.
+ */
+void test_RejectsBadManifests() {
+    FleetManifest m;
+
+    ASSERT_TRUE(!m.parse("fleet,Ghost,2\n") && m.error.find("Ghost") != string::npos, "\tUnknown type should be named in the error");
+    ASSERT_TRUE(!m.parse("type,A,1,1,0,1,1,0\n") && m.error.find("Line 1") == 0, "\tZero time to charge should be rejected with its line");
+    ASSERT_TRUE(!m.parse("type,A,1,1,1,1,1,0\ntype,A,1,1,1,1,1,0\n") && m.types.empty(), "\tDuplicate type should be rejected");
+    ASSERT_TRUE(!m.parse("type,A,1,1,1,1,1,0\nfleet,A,2.5\n"), "\tFractional vehicle count should be rejected");
+    ASSERT_TRUE(!m.parse("type,A,1,1,1,1,1,0\nfleet,A,2000000000\nfleet,A,200000000\n") && m.composition.empty(),
+                "\tA fleet with more vehicles than int ids can number should be rejected");
+    ASSERT_TRUE(m.parse("type,A,1,1,1,1,1,0\nfleet,A,2147483647\n") && m.vehicle_Count() == 2147483647u,
+                "\tA fleet of exactly INT_MAX vehicles should be accepted");
+    ASSERT_TRUE(!m.parse("bogus,row\n"), "\tUnknown record kind should be rejected");
+    ASSERT_TRUE(!m.parse("{\"types\": [}"), "\tMalformed JSON should be rejected");
+    ASSERT_TRUE(!m.load("no_such_manifest.csv"), "\tMissing file should be rejected");
+}
+
+/**
+ * @brief Verifies a manifest file builds the simulation's types and fleet.
+ */
+void test_SimulationFromManifest() {
+    ofstream out("manifest_test.csv");
+    out << "type,Alpha Company,120,320,0.6,1.6,4,0.25\n"
+        << "type,Bravo Company,100,100,0.2,1.5,5,0.10\n"
+        << "fleet,Bravo Company,1000\n"
+        << "fleet,Alpha Company,500\n";
+    out.close();
+
+    FleetManifest m;
+    bool ok = m.load("manifest_test.csv");
+
+    Simulation sim;
+    sim.set_Seed(4);
+    sim.vehicle_Init(m);
+    VehicleFleet &fleet = sim.get_Fleet();
+
+    ASSERT_TRUE(ok, "\tManifest file should load");
+    ASSERT_TRUE(sim.get_VehicleCount() == 1500, "\tFleet should hold every vehicle in the manifest");
+    ASSERT_TRUE(fleet.type_Id[0] == 1 && fleet.type_Id[999] == 1 && fleet.type_Id[1000] == 0, "\tVehicles should follow the manifest order with registered TypeIds");
+    ASSERT_TRUE(fleet.battery_Capacity[1000] == 320 && fleet.passenger_Count[0] == 5, "\tVehicles should take their type's parameters");
+    ASSERT_TRUE(sim.getStats().find_Type("Bravo Company") == 1, "\tStatistics should know the manifest's types");
+}
+
+/**
+ * @brief Main function to run all FleetManifest tests.
+ * 
+ * @return int Returns 0 after all tests complete.
+ */
+int main() {
+    cout << "--- Running FleetManifest Unit Tests ---" << endl;
+
+    test_CsvTypesAndComposition();
+    test_JsonManifest();
+    test_RejectsBadManifests();
+    test_SimulationFromManifest();
+    cout << "--- All FleetManifest Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+
+#include "ParameterSweep.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ *
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Builds the base scenario of every test: 120 Alpha and 80 Echo vehicles.
+ */
+FleetManifest base_Fleet() {
+    FleetManifest manifest;
+    manifest.parse("type,Alpha,120,320,0.6,1.6,4,0.25\n"
+                   "type,Echo,30,150,0.3,5.8,2,0.61\n"
+                   "fleet,Alpha,120\n"
+                   "fleet,Echo,80\n");
+    return manifest;
+}
+
+/**
+ * @brief Tests that grid axes are crossed in odometer order with counts rounded.
+ */
+void test_GridPoints() {
+    ParameterSweep sweep(base_Fleet(), 1);
+    bool added = sweep.add_Grid("chargers", {1, 2.4, 3}) && sweep.add_Grid("Alpha.fault_probability", {0.1, 0.5});
+    vector<vector<double>> points = sweep.points();
+
+    ASSERT_TRUE(added && points.size() == 6, "\tA 3 x 2 grid should have 6 points");
+    ASSERT_TRUE(points[0] == vector<double>({1, 0.1}) && points[1] == vector<double>({1, 0.5}) &&
+                points[5] == vector<double>({3, 0.5}), "\tThe last axis should change fastest");
+    ASSERT_TRUE(points[2][0] == 2, "\tCharger counts should be rounded to whole numbers");
+}
+
+/**
+ * @brief Tests that a Latin-hypercube sample takes one value from every stratum of each range.
+ */
+void test_LatinHypercube() {
+    ParameterSweep sweep(base_Fleet(), 1);
+    sweep.set_Seed(3);
+    sweep.add_Range("time_increment", 0.1, 0.6);
+    sweep.add_Range("Echo.cruise_speed", 20, 40);
+    sweep.set_Samples(10);
+    vector<vector<double>> points = sweep.points();
+
+    bool stratified = points.size() == 10;
+    for (size_t a = 0; stratified && a < 2; ++a)
+    {
+        double low = a == 0 ? 0.1 : 20, high = a == 0 ? 0.6 : 40;
+        vector<int> hits(10, 0);
+        for (const vector<double> &p : points)
+        {
+            int stratum = static_cast<int>((p[a] - low) / (high - low) * 10);
+            if (stratum >= 0 && stratum < 10)
+                hits[stratum]++;
+        }
+        stratified = count(hits.begin(), hits.end(), 1) == 10;
+    }
+    ASSERT_TRUE(stratified, "\tEvery stratum of every range should be sampled exactly once");
+
+    ParameterSweep again(base_Fleet(), 1);
+    again.set_Seed(3);
+    again.add_Range("time_increment", 0.1, 0.6);
+    again.add_Range("Echo.cruise_speed", 20, 40);
+    again.set_Samples(10);
+    again.add_Grid("sites", {1, 2});
+    vector<vector<double>> crossed = again.points();
+    ASSERT_TRUE(crossed.size() == 20 && crossed[0][0] == points[0][0] && crossed[19][1] == points[9][1],
+                "\tThe same seed should give the same sample, crossed with every grid point");
+}
+
+/**
+ * @brief Tests that unknown parameters and malformed specs are rejected with a reason.
+ */
+void test_RejectsBadSpecs() {
+    ParameterSweep sweep(base_Fleet(), 1);
+    ASSERT_TRUE(!sweep.add_Grid("warp_factor", {1}) && !sweep.error.empty(), "\tAn unknown parameter should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("Zulu.cruise_speed", {1}), "\tA parameter of an unknown type should be rejected");
+
+    ParameterSweep spec(base_Fleet(), 1);
+    bool ok = spec.parse("# capacity study\n"
+                         "grid,chargers,2,4,8\n"
+                         "range,mix.Echo,0,160\n"
+                         "samples,5\n"
+                         "replications,3\n");
+    ASSERT_TRUE(ok && spec.points().size() == 15, "\tA valid spec should give grid x sample points");
+
+    ParameterSweep broken(base_Fleet(), 1);
+    ASSERT_TRUE(!broken.parse("grid,chargers,2\ngrid,sites,one\n") && broken.error.find("Line 2") == 0,
+                "\tA malformed spec should report its line");
+}
+
+/**
+ * @brief Tests that values a run cannot use are rejected when their axis is added.
+ */
+void test_RejectsInvalidValues() {
+    ParameterSweep sweep(base_Fleet(), 1);
+    ASSERT_TRUE(!sweep.parse("grid,time_increment,0\n") && sweep.error.find("Line 1") == 0,
+                "\tA zero time increment should be rejected instead of never finishing");
+    ASSERT_TRUE(!sweep.add_Range("sim_time", -1, 3), "\tA range reaching a negative duration should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("Alpha.battery_capacity", {320, -10}), "\tA negative battery capacity should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("Alpha.time_to_charge", {0}), "\tA zero charge time should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("Alpha.fault_probability", {-0.1}), "\tA negative fault probability should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("sites", {0}) && !sweep.add_Grid("chargers", {nan("")}),
+                "\tNo sites or a non-number should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("fleet_size", {3e9}), "\tA fleet larger than int ids can number should be rejected");
+    ASSERT_TRUE(!sweep.add_Grid("chargers", {1e12}) && !sweep.add_Range("sites", 1, 1e12) && !sweep.add_Grid("Alpha.passenger_count", {3e9}),
+                "\tCounts past INT_MAX should be rejected");
+    ASSERT_TRUE(!sweep.parse("samples,1e12\n") && !sweep.parse("replications,1e12\n"), "\tSample and replication counts past INT_MAX should be rejected");
+    ASSERT_TRUE(sweep.points().size() == 1, "\tRejected axes should not be added");
+
+    ParameterSweep valid(base_Fleet(), 1);
+    ASSERT_TRUE(valid.add_Grid("Alpha.fault_probability", {0, 0.5}) && valid.add_Grid("chargers", {0, 2}),
+                "\tNo faults and no chargers are valid scenarios");
+}
+
+/**
+ * @brief Tests that more chargers shorten the charger queue and that fleet size is applied.
+ */
+void test_SweepResults() {
+    ParameterSweep sweep(base_Fleet(), 4);
+    sweep.set_Seed(11);
+    sweep.set_Replications(4);
+    sweep.add_Grid("fleet_size", {0, 200});
+    sweep.add_Grid("chargers", {1, 40});
+    sweep.run();
+    const vector<SweepResult> &results = sweep.get_Results();
+
+    ASSERT_TRUE(results.size() == 4 && results[0].flights.mean == 0 && results[0].flights.samples == 4,
+                "\tAn empty fleet should fly nothing in every replication");
+    ASSERT_TRUE(results[2].flights.mean > 0 && results[2].queue_Wait.samples == 4, "\tOne charger should make 200 vehicles queue");
+    ASSERT_TRUE(results[3].queue_Wait.samples == 0 || results[3].queue_Wait.mean < results[2].queue_Wait.mean,
+                "\tForty chargers should shorten the queue");
+}
+
+/**
+ * @brief Tests that the results table has a row per point and does not depend on the thread count.
+ */
+void test_TableIsDeterministic() {
+    string tables[2];
+    size_t threads[2] = {1, 4};
+    for (int i = 0; i < 2; ++i)
+    {
+        ParameterSweep sweep(base_Fleet(), threads[i]);
+        sweep.set_Seed(7);
+        sweep.set_Replications(3);
+        sweep.add_Grid("chargers", {2, 6});
+        sweep.add_Range("Alpha.fault_probability", 0.1, 1.0);
+        sweep.set_Samples(4);
+        sweep.run();
+
+        ostringstream out;
+        sweep.write_Table(out);
+        tables[i] = out.str();
+    }
+
+    ASSERT_TRUE(tables[0] == tables[1], "\tThe table should be identical on 1 and 4 threads");
+    ASSERT_TRUE(count(tables[0].begin(), tables[0].end(), '\n') == 9, "\tThe table should have a header and 8 rows");
+    ASSERT_TRUE(tables[0].rfind("point,chargers,Alpha.fault_probability,replications,passenger_miles,", 0) == 0,
+                "\tThe header should list the axes before the metrics");
+}
+
+/**
+ * @brief Main function to run all parameter sweep related unit tests.
+ *
+ * Executes all defined tests and prints their results to the console.
+ *
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- ParameterSweep Unit Tests ---\n" << endl;
+    test_GridPoints();
+    test_LatinHypercube();
+    test_RejectsBadSpecs();
+    test_RejectsInvalidValues();
+    test_SweepResults();
+    test_TableIsDeterministic();
+    cout << "\n--- All ParameterSweep Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include "PhaseProfiler.h"
+#include "Simulation.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Tests that a scope adds its elapsed time and one call to its phase.
+ */
+void test_ScopeTimesPhase() {
+    PhaseProfiler profiler;
+    for (int i = 0; i < 2; ++i)
+    {
+        PhaseScope scope(profiler, Phase::Chargers);
+        this_thread::sleep_for(chrono::milliseconds(2));
+    }
+
+    ASSERT_TRUE(profiler.calls(Phase::Chargers) == 2, "\tEach scope should count one call");
+    ASSERT_TRUE(profiler.nanoseconds(Phase::Chargers) >= 4000000, "\tPhase time should cover both scopes");
+    ASSERT_TRUE(profiler.calls(Phase::Fly) == 0 && profiler.nanoseconds(Phase::Fly) == 0, "\tOther phases should stay untouched");
+}
+
+/**
+ * @brief Tests counters and queue depth samples from several threads, and reset.
+ */
+void test_CountersAndQueue() {
+    PhaseProfiler profiler;
+    vector<thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&profiler, t] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                profiler.count(Counter::Flights);
+                PhaseScope scope(profiler, Phase::Settle);
+            }
+            profiler.sample_Queue(10 * (t + 1));
+        });
+    }
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+
+    ASSERT_TRUE(profiler.value(Counter::Flights) == 4000, "\tCounts from every thread should be added");
+    ASSERT_TRUE(profiler.calls(Phase::Settle) == 4000, "\tScopes from every thread should be added");
+    ASSERT_TRUE(profiler.queue_Max() == 40 && profiler.queue_Mean() == 25.0, "\tQueue samples should give peak and mean depth");
+
+    profiler.reset();
+    ASSERT_TRUE(profiler.value(Counter::Flights) == 0 && profiler.calls(Phase::Settle) == 0 && profiler.queue_Max() == 0, "\tReset should zero everything");
+}
+
+/**
+ * @brief Tests that the report lists the phases that ran and the counters.
+ */
+void test_PrintListsPhases() {
+    PhaseProfiler profiler;
+    {
+        PhaseScope run(profiler, Phase::Run);
+        PhaseScope fly(profiler, Phase::Fly);
+    }
+    profiler.count(Counter::Ticks, 6);
+
+    ostringstream out;
+    profiler.print(out);
+    string report = out.str();
+
+    ASSERT_TRUE(report.find("Fly") != string::npos && report.find("Run") != string::npos, "\tReport should list the phases that ran");
+    ASSERT_TRUE(report.find("Merge") == string::npos, "\tReport should skip phases that never ran");
+    ASSERT_TRUE(report.find("Ticks 6") != string::npos, "\tReport should list the counters");
+}
+
+/**
+ * @brief Tests the instrumentation of a full run.
+ *
+ * In an EVTOL_PROFILE build the counters must agree with the statistics; in a normal
+ * build the instrumentation is compiled out and nothing may be recorded.
+ */
+void test_SimulationRun() {
+    Simulation sim;
+    sim.set_Seed(11);
+    sim.set_PrintSummary(false);
+    sim.set_FaultLogPath("");
+    sim.vehicle_Init();
+    sim.run_Sim();
+
+    const PhaseProfiler &profiler = sim.get_Profiler();
+    int flights = 0, charges = 0, faults = 0;
+    for (const Stats &s : sim.getStats().StatList)
+    {
+        flights += s.flight_count;
+        charges += s.charge_count;
+        faults += s.total_Faults;
+    }
+
+#if defined(EVTOL_PROFILE)
+    ASSERT_TRUE(profiler.value(Counter::Ticks) == 6 && profiler.calls(Phase::Run) == 1, "\tProfile should count every tick of one run");
+    ASSERT_TRUE(profiler.value(Counter::Flights) == uint64_t(flights) && profiler.value(Counter::Faults) == uint64_t(faults),
+                "\tProfile counters should match the statistics");
+    ASSERT_TRUE(profiler.value(Counter::Charges) > 0 && profiler.value(Counter::Charges) <= uint64_t(charges),
+                "\tSettled charges should be among the logged ones");
+    ASSERT_TRUE(profiler.nanoseconds(Phase::Fly) <= profiler.nanoseconds(Phase::Run), "\tA single-threaded phase should fit inside the run");
+#else
+    ASSERT_TRUE(profiler.value(Counter::Ticks) == 0 && profiler.calls(Phase::Run) == 0 && flights > 0, "\tInstrumentation should be compiled out");
+#endif
+}
+
+/**
+ * @brief Main function to run all PhaseProfiler related unit tests.
+ * 
+ * Executes all defined tests and prints their results to the console.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- PhaseProfiler Unit Tests ---\n" << endl;
+    test_ScopeTimesPhase();
+    test_CountersAndQueue();
+    test_PrintListsPhases();
+    test_SimulationRun();
+    cout << "\n--- All PhaseProfiler Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
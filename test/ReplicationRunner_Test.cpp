@@ -0,0 +1,158 @@
+#include <iostream>
+#include <atomic>
+#include <cmath>
+
+#include "ReplicationRunner.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL" << message << endl; \
+    } else { \
+        cout << "PASS" << message << endl; \
+    } \
+
+/**
+ * @brief Verifies the thread pool runs every submitted task, including tasks submitted by tasks.
+ */
+void test_PoolRunsAllTasks() {
+    ThreadPool pool(4);
+    atomic<int> done{0};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        pool.submit([&pool, &done] {
+            done++;
+            pool.submit([&done] { done++; });
+        });
+    }
+    pool.wait_Idle();
+
+    ASSERT_TRUE(done == 200, "\tEvery task and nested task should run before wait_Idle returns");
+}
+
+/**
+ * @brief Stresses nested submissions from many workers while wait_Idle is waiting.
+ *
+ * Nested tasks are stolen by other workers while their parents are still submitting, so
+ * a task counted only after it was published would be finished before it was counted.
+ */
+void test_PoolWaitsForNestedTasks() {
+    ThreadPool pool(8);
+    bool complete = true;
+
+    for (int iteration = 0; iteration < 500 && complete; ++iteration)
+    {
+        atomic<int> done{0};
+        for (int i = 0; i < 64; ++i)
+        {
+            pool.submit([&pool, &done] {
+                for (int k = 0; k < 50; ++k)
+                    pool.submit([&done] { done++; });
+            });
+        }
+        pool.wait_Idle();
+        complete = done == 64 * 50;
+    }
+
+    ASSERT_TRUE(complete, "\twait_Idle should only return once every nested task has finished");
+}
+
+/**
+ * @brief Verifies mean, variance and confidence interval of a known sample.
+ */
+void test_EstimateMatchesKnownSample() {
+    Estimate e;
+    double samples[] = {2, 4, 4, 4, 5, 5, 7, 9};
+
+    for (double x : samples)
+        e.add(x);
+
+    ASSERT_TRUE(e.mean == 5.0, "\tMean should be 5");
+    ASSERT_TRUE(fabs(e.variance() - 32.0 / 7.0) < 1e-12, "\tSample variance should be 32/7");
+    ASSERT_TRUE(fabs(e.ci95() - 1.96 * sqrt(32.0 / 7.0 / 8.0)) < 1e-12, "\tCI should be 1.96 standard errors");
+}
+
+/**
+ * @brief Verifies every replication produces its own statistics.
+ */
+void test_RunnerKeepsEveryReplication() {
+    ReplicationRunner runner(16, 4);
+    runner.run();
+
+    bool allFlew = true;
+    for (const Statistics &stats : runner.get_Results())
+    {
+        int flights = 0;
+        for (const Stats &s : stats.StatList)
+            flights += s.flight_count;
+        allFlew = allFlew && flights > 0;
+    }
+
+    ASSERT_TRUE(runner.get_Results().size() == 16, "\tOne result per replication");
+    ASSERT_TRUE(allFlew, "\tEvery replication should log flights");
+}
+
+/**
+ * @brief Verifies per-type summaries count every replication for totals.
+ */
+void test_SummaryCountsReplications() {
+    ReplicationRunner runner(8, 2, true);
+    runner.run();
+
+    vector<ReplicationSummary> summary = runner.summarize();
+
+    bool counted = !summary.empty();
+    for (const ReplicationSummary &s : summary)
+        counted = counted && s.faults.samples == 8 && s.avg_FlightTime.samples <= 8;
+
+    ASSERT_TRUE(counted, "\tTotals should have one sample per replication");
+}
+
+/**
+ * @brief Verifies a seeded set of replications gives the same results with any thread count.
+ */
+void test_SeededRunnerIndependentOfThreads() {
+    ReplicationRunner one(12, 1, true), many(12, 4, true);
+    one.set_Seed(99);
+    many.set_Seed(99);
+    one.run();
+    many.run();
+
+    bool same = true;
+    for (int r = 0; r < 12; ++r)
+    {
+        const Statistics &x = one.get_Results()[r];
+        const Statistics &y = many.get_Results()[r];
+        for (size_t i = 0; i < x.StatList.size(); ++i)
+            same = same && x.StatList[i].total_FlightTime == y.StatList[i].total_FlightTime
+                        && x.StatList[i].total_Faults == y.StatList[i].total_Faults;
+    }
+
+    ASSERT_TRUE(same, "\tSeeded replications should not depend on the thread count");
+}
+
+/**
+ * @brief Entry point to run all ReplicationRunner related unit tests.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- Running ReplicationRunner Unit Tests ---" << endl;
+    test_PoolRunsAllTasks();
+    test_PoolWaitsForNestedTasks();
+    test_EstimateMatchesKnownSample();
+    test_RunnerKeepsEveryReplication();
+    test_SummaryCountsReplications();
+    test_SeededRunnerIndependentOfThreads();
+    cout << "--- All ReplicationRunner Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <string>
+#include <memory_resource>
+
+#include "SimulationArena.h"
+#include "Simulation.h"
+#include "EventQueue.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ *
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Heap-backed resource counting the allocations made through it.
+ */
+class CountingUpstream : public pmr::memory_resource{
+    public:
+        size_t allocations = 0;         // Blocks handed out so far
+        size_t deallocations = 0;       // Blocks given back so far
+
+    private:
+        void* do_allocate(size_t size, size_t alignment) override {
+            allocations++;
+            return pmr::new_delete_resource()->allocate(size, alignment);
+        }
+
+        void do_deallocate(void *p, size_t size, size_t alignment) override {
+            deallocations++;
+            pmr::new_delete_resource()->deallocate(p, size, alignment);
+        }
+
+        bool do_is_equal(const pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+};
+
+/**
+ * @brief Tests that many container allocations take few upstream chunks, all returned at teardown.
+ */
+void test_TeardownReturnsEveryChunk() {
+    CountingUpstream upstream;
+    {
+        SimulationArena arena(4096, &upstream);
+        pmr::vector<pmr::vector<int>> lists(arena.resource());
+        for (int i = 0; i < 200; ++i)
+        {
+            lists.emplace_back(static_cast<size_t>(i + 1), i);
+        }
+        lists.erase(lists.begin(), lists.begin() + 100);
+
+        ASSERT_TRUE(arena.chunk_Count() == upstream.allocations && upstream.allocations < 20,
+                    "\t200 vectors should be carved out of a handful of chunks");
+        ASSERT_TRUE(upstream.deallocations == 0, "\tFreeing inside the arena should not reach the upstream resource");
+        ASSERT_TRUE(lists.back().size() == 200 && lists.back()[199] == 199, "\tArena memory should hold the values written");
+    }
+    ASSERT_TRUE(upstream.allocations > 0 && upstream.deallocations == upstream.allocations,
+                "\tDestroying the arena should return every chunk");
+}
+
+/**
+ * @brief Tests that a simulation keeps its fleet in its own arena.
+ */
+void test_SimulationUsesArena() {
+    FleetManifest manifest;
+    manifest.parse("type,Alpha,120,320,0.6,1.6,4,0.25\n"
+                   "fleet,Alpha,10000\n");
+
+    Simulation sim;
+    sim.set_PrintSummary(false);
+    sim.set_FaultLogPath("");
+    sim.set_Seed(5);
+    sim.vehicle_Init(manifest);
+    sim.run_Sim();
+
+    VehicleFleet &fleet = sim.get_Fleet();
+    ASSERT_TRUE(fleet.resource() != pmr::get_default_resource(), "\tThe fleet should not allocate from the global heap");
+    ASSERT_TRUE(sim.get_Arena().reserved_Bytes() >= fleet.size() * sizeof(double) * 10,
+                "\tThe arena should hold the per-vehicle arrays");
+    ASSERT_TRUE(sim.get_Arena().chunk_Count() <= 10, "\tA fleet of 10000 vehicles should need only a few chunks");
+
+    VehicleFleet copy = fleet;
+    ASSERT_TRUE(copy.resource() == pmr::get_default_resource() && copy.current_Battery == fleet.current_Battery,
+                "\tA copy of the fleet should own its memory and outlive the simulation");
+}
+
+/**
+ * @brief Tests that a cleared event queue reuses its storage.
+ */
+void test_EventQueueReusesStorage() {
+    CountingUpstream upstream;
+    EventQueue q(&upstream);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        q.push(1000.0 - i, EventType::Fault, i);
+    }
+    size_t first = upstream.allocations;
+    q.clear();
+    for (int i = 0; i < 1000; ++i)
+    {
+        q.push(i, EventType::Depletion, i);
+    }
+
+    ASSERT_TRUE(first > 0 && upstream.allocations == first, "\tRefilling a cleared queue should not allocate");
+    ASSERT_TRUE(q.pop().vehicle == 0 && q.size() == 999, "\tThe refilled queue should pop the earliest event");
+}
+
+/**
+ * @brief Main function to run all simulation arena related unit tests.
+ *
+ * Executes all defined tests and prints their results to the console.
+ *
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- SimulationArena Unit Tests ---\n" << endl;
+    test_TeardownReturnsEveryChunk();
+    test_SimulationUsesArena();
+    test_EventQueueReusesStorage();
+    cout << "\n--- All SimulationArena Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
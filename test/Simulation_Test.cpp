@@ -1,10 +1,12 @@
 
 #include <iostream>
 #include <cassert>
+#include <cmath>
+#include <cstdlib>
 
 #include "Simulation.h"
 #include "Vehicle.h"
-#include "Vehicle_Instance.h"
+#include "VehicleFleet.h"
 #include "ChargerManager.h"
 
 using namespace std;
@@ -47,15 +49,15 @@ void test_PartialSimulation_TimeUpdate() {
 }
 
 /**
- * @brief Tests if a valid vehicle pointer is returned when accessed by an index.
+ * @brief Tests if the fleet state is accessible and holds every vehicle.
  */
-void test_VehiclePointer_Access() {
+void test_Fleet_Access() {
     Simulation sim;
     sim.vehicle_Init();
 
-    VehicleInstance* v = sim.get_VehiclePointer(0);
+    VehicleFleet &fleet = sim.get_Fleet();
 
-    ASSERT_TRUE(v != nullptr, "\tVehicle pointer access successful");
+    ASSERT_TRUE(fleet.size() == static_cast<size_t>(sim.get_VehicleCount()) && fleet.current_Battery[0] > 0.0, "\tFleet access successful");
 }
 
 /**
@@ -65,9 +67,8 @@ void test_ChargingRequest() {
     Simulation sim;
     sim.vehicle_Init();
 
-    VehicleInstance* v = sim.get_VehiclePointer(0);
-    v->current_Battery = 0.0;
-    sim.request_ChargingForVehicle(v);
+    sim.get_Fleet().current_Battery[0] = 0.0;
+    sim.request_ChargingForVehicle(0);
     
     ASSERT_TRUE(!sim.get_Chargers().charger_Availability() || true, "\tCharging request registered");
 }
@@ -86,31 +87,33 @@ void test_ChargerManagerAccess() {
 void test_FaultAndDegradation()
 {
     Vehicle testVehicle("Test", 100, 100, 1.0, 1.0, 1, 0.5);  // 50% fault probability per hour
-    VehicleInstance v(testVehicle);
+    VehicleFleet fleet;
+    fleet.set_Seed(3);                                                      // Fixed fault times keep the test deterministic
+    int v = fleet.add(0, testVehicle);
 
-    double initialCruise = v.actualCruiseSpeed;
-    int faultsBefore = v.fault_Count;
+    double initialCruise = fleet.actualCruiseSpeed[v];
+    int faultsBefore = fleet.fault_Count[v];
     int faultEvents = 0;
 
     // Simulate for 3 hours in 0.1 hour steps
     for (int i = 0; i < 30; ++i)
     {
-        v.fly(0.1);
-        bool fault = v.simulate_Fault(0.1);
-        if (fault) {
+        fleet.current_Battery[v] = fleet.battery_Capacity[v];              // Keeps the vehicle airborne for the whole 3 hours
+        fleet.fly(v, 0.1);
+        while (fleet.simulate_Fault(v)) {
             faultEvents++;
-            v.actualCruiseSpeed *= 0.98;                                    // Reduces cruise speed when fault occurs
-            if (v.actualCruiseSpeed < 0.5 * v.vehicle_type.cruiseSpeed)     // Ensures that the cruise speed isnt defraded too much
-                v.actualCruiseSpeed = 0.5 * v.vehicle_type.cruiseSpeed;
+            fleet.actualCruiseSpeed[v] *= 0.98;                                         // Reduces cruise speed when fault occurs
+            if (fleet.actualCruiseSpeed[v] < 0.5 * fleet.cruiseSpeed[v])   // Ensures that the cruise speed isnt defraded too much
+                fleet.actualCruiseSpeed[v] = 0.5 * fleet.cruiseSpeed[v];
         }
     }
 
     cout << "\n--- Fault & Cruise Speed Degradation Test ---\n";
-    cout << "Faults occurred: " << (v.fault_Count - faultsBefore) << "\n";
+    cout << "Faults occurred: " << (fleet.fault_Count[v] - faultsBefore) << "\n";
     cout << "Initial cruise speed: " << initialCruise << " mph\n";
-    cout << "Final cruise speed:   " << v.actualCruiseSpeed << " mph\n";
+    cout << "Final cruise speed:   " << fleet.actualCruiseSpeed[v] << " mph\n";
 
-    if (faultEvents > 0 && v.actualCruiseSpeed < initialCruise)
+    if (faultEvents > 0 && fleet.actualCruiseSpeed[v] < initialCruise)
         cout << "PASS: Faults occurred and cruise speed degraded.\n";
     else
         cout << "FAIL: No degradation in cruise speed.\n";
@@ -122,18 +125,176 @@ void test_FaultAndDegradation()
 void test_ChargeLogging_AfterRecharge() {
     Simulation sim;
     sim.vehicle_Init();
-    VehicleInstance* v = sim.get_VehiclePointer(0);
+    VehicleFleet &fleet = sim.get_Fleet();
 
     // Deplete battery and run short simulation to charge
-    v->current_Battery = 0.0;
-    sim.request_ChargingForVehicle(v);
+    fleet.current_Battery[0] = 0.0;
+    sim.request_ChargingForVehicle(0);
     sim.run_PartialSimulation(3.0);     // enough to fully charge
 
-    int chargeSessions = sim.getStats().get_ChargerCount(v->vehicle_type.name);
+    int chargeSessions = sim.getStats().get_ChargerCount(sim.getStats().type_Names[fleet.type_Id[0]]);
 
     ASSERT_TRUE(chargeSessions > 0, "\tCharge session should be logged after recharge");
 }
 
+/**
+ * @brief Ensures the event-driven engine advances the clock to the end of the simulation.
+ */
+void test_EventSim_ReachesSimTime() {
+    Simulation sim;
+    sim.vehicle_Init();
+    sim.run_EventSim();
+
+    ASSERT_TRUE(sim.get_CurrentTime() == sim.get_SimTime(), "\tEvent engine reached the simulation horizon");
+}
+
+/**
+ * @brief Verifies the event-driven and fixed-step engines log the same flights for a seeded fleet.
+ *
+ * With a small time increment the fixed-step loop lands within a tick of every event, so
+ * both engines must count the same flights and faults, and per-flight times, distances
+ * and passenger miles may differ only by that rounding.
+ */
+void test_EventSim_MatchesFixedStep() {
+    const double tick = 0.001;
+    Simulation fixed, event;
+    for (Simulation *sim : {&fixed, &event})
+    {
+        sim->set_Seed(7);
+        sim->set_PrintSummary(false);
+        sim->set_FaultLogPath("");
+        sim->set_TimeIncrement(tick);
+        sim->vehicle_Init();
+    }
+    fixed.run_Sim();
+    event.run_EventSim();
+
+    int flights = 0;
+    bool counts = true, values = true;
+    for (size_t i = 0; i < fixed.getStats().StatList.size(); ++i)
+    {
+        const Stats &x = fixed.getStats().StatList[i];
+        const Stats &y = event.getStats().StatList[i];
+        flights += y.flight_count;
+        counts = counts && x.flight_count == y.flight_count && x.total_Faults == y.total_Faults;
+        if (y.flight_count == 0)
+            continue;                                           // Type not drawn for this fleet
+        values = values && fabs(x.avg_FlightTime() - y.avg_FlightTime()) <= 2 * tick
+            && fabs(x.avg_Distance() - y.avg_Distance()) <= 1e-3 * y.avg_Distance()
+            && abs(x.total_PassengerMiles - y.total_PassengerMiles) <= y.flight_count;    // Each flight truncates to whole miles
+    }
+
+    ASSERT_TRUE(flights >= event.get_VehicleCount(), "\tEvery vehicle logged at least one flight");
+    ASSERT_TRUE(counts, "\tBoth engines should log the same number of flights and faults");
+    ASSERT_TRUE(values, "\tBoth engines should log the same per-flight time, distance and passenger miles");
+}
+
+/**
+ * @brief Verifies an event-driven run leaves the fleet at the simulation horizon, not at each vehicle's last event.
+ *
+ * Vehicles still flying must carry the session flown up to sim_time, as after a fixed-step
+ * run with a small tick, and charging vehicles must be charged up to sim_time.
+ */
+void test_EventSim_FleetAtSimTime() {
+    const double tick = 1.0 / 1024;                                 // Exact in binary, so the fixed-step clock lands on sim_time
+    Simulation fixed, event;
+    for (Simulation *sim : {&fixed, &event})
+    {
+        sim->set_Seed(5);
+        sim->set_PrintSummary(false);
+        sim->set_FaultLogPath("");
+        sim->set_TimeIncrement(tick);
+        sim->vehicle_Init();
+    }
+    fixed.run_Sim();
+    event.run_EventSim();
+
+    const VehicleFleet &x = fixed.get_Fleet();
+    const VehicleFleet &y = event.get_Fleet();
+    bool flying = true, charging = true;
+    for (size_t i = 0; i < y.size(); ++i)
+    {
+        flying = flying && x.charge_State[i] == y.charge_State[i]
+            && fabs(x.session_FlightTime[i] - y.session_FlightTime[i]) <= 10 * tick;     // Every flight and charge before it may end a tick late
+        if (y.charge_State[i] == ChargeState::Charging)
+            charging = charging && y.charged_Until[i] == event.get_SimTime();
+    }
+
+    ASSERT_TRUE(flying, "\tFlights in the air should be flown up to the simulation horizon");
+    ASSERT_TRUE(charging, "\tCharging vehicles should be charged up to the simulation horizon");
+}
+
+/**
+ * @brief Verifies two simulations with the same seed produce identical statistics.
+ */
+void test_SeededRunsMatch() {
+    Simulation a, b;
+    a.set_Seed(2024);
+    b.set_Seed(2024);
+    a.set_PrintSummary(false);
+    b.set_PrintSummary(false);
+    a.set_FaultLogPath("");
+    b.set_FaultLogPath("");
+
+    a.vehicle_Init();
+    b.vehicle_Init();
+    a.run_Sim();
+    b.run_Sim();
+
+    bool same = a.getStats().StatList.size() == b.getStats().StatList.size();
+    for (size_t i = 0; same && i < a.getStats().StatList.size(); ++i)
+    {
+        const Stats &x = a.getStats().StatList[i];
+        const Stats &y = b.getStats().StatList[i];
+        same = x.total_FlightTime == y.total_FlightTime && x.total_Faults == y.total_Faults
+            && x.flight_count == y.flight_count && x.total_PassengerMiles == y.total_PassengerMiles;
+    }
+
+    ASSERT_TRUE(same, "\tSame seed should reproduce the same statistics");
+}
+
+/**
+ * @brief Verifies the parallel tick reproduces the serial run of a large seeded fleet exactly.
+ *
+ * The fleet spans many chunks, so flights, faults and charge requests are handled on
+ * several threads and merged back.
+ */
+void test_ParallelTickMatchesSerial() {
+    FleetManifest manifest;
+    manifest.parse("type,Alpha,120,320,0.6,1.6,4,0.25\n"
+                   "type,Charlie,160,220,0.8,2.2,3,0.5\n"
+                   "fleet,Alpha,20000\n"
+                   "fleet,Charlie,20000\n");
+
+    Simulation serial, parallel;
+    for (Simulation *sim : {&serial, &parallel})
+    {
+        sim->set_Seed(77);
+        sim->set_PrintSummary(false);
+        sim->set_FaultLogPath("");
+        sim->vehicle_Init(manifest);
+        sim->get_Chargers().set_Sites(vector<int>(50, 20));
+    }
+    parallel.set_TickThreads(4);
+    serial.run_Sim();
+    parallel.run_Sim();
+
+    bool same = true;
+    for (size_t i = 0; i < serial.getStats().StatList.size(); ++i)
+    {
+        const Stats &x = serial.getStats().StatList[i];
+        const Stats &y = parallel.getStats().StatList[i];
+        same = same && x.total_FlightTime == y.total_FlightTime && x.total_Faults == y.total_Faults
+            && x.flight_count == y.flight_count && x.charge_count == y.charge_count
+            && x.total_ChargingTime == y.total_ChargingTime && x.flight_Time.quantile(0.99) == y.flight_Time.quantile(0.99);
+    }
+    same = same && serial.get_Fleet().current_Battery == parallel.get_Fleet().current_Battery
+        && serial.get_Fleet().fault_Count == parallel.get_Fleet().fault_Count;
+
+    ASSERT_TRUE(serial.getStats().StatList[0].flight_count > 0, "\tLarge fleet should complete flights");
+    ASSERT_TRUE(same, "\tParallel tick should match the serial run exactly");
+}
+
 /**
  * @brief Main entry point to run all unit tests related to the Simulation class.
  * 
@@ -143,11 +304,16 @@ int main() {
     cout << "--- Running Simulation Unit Tests ---\n" << endl;
     test_VehicleCount_Initialization();
     test_PartialSimulation_TimeUpdate();
-    test_VehiclePointer_Access();
+    test_Fleet_Access();
     test_ChargingRequest();
     test_ChargerManagerAccess();
     test_FaultAndDegradation();
     test_ChargeLogging_AfterRecharge();
+    test_EventSim_ReachesSimTime();
+    test_EventSim_MatchesFixedStep();
+    test_EventSim_FleetAtSimTime();
+    test_SeededRunsMatch();
+    test_ParallelTickMatchesSerial();
     cout << "\n--- Simulation Unit Tests Completed ---" << endl;
     return 0;
 }
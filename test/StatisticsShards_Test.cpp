@@ -0,0 +1,138 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <cstdint>
+
+#include "Statistics.h"
+#include "StatisticsShards.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Tests that every shard starts on its own cache line.
+ */
+void test_ShardsArePadded() {
+    StatisticsShards shards;
+    shards.resize(8);
+
+    bool padded = true;
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        uintptr_t address = reinterpret_cast<uintptr_t>(&shards[i]);
+        padded = padded && address % 64 == 0;
+        if (i > 0)
+            padded = padded && address - reinterpret_cast<uintptr_t>(&shards[i - 1]) >= 64;
+    }
+
+    ASSERT_TRUE(padded, "\tShards should be cache-line aligned and never share a line");
+
+    Statistics layout;
+    layout.register_Type(0, "Alpha");
+    layout.register_Type(1, "Bravo");
+    shards.prepare(layout);
+
+    bool lines = sizeof(Stats) % 64 == 0;
+    for (size_t i = 0; i < shards.size(); ++i)
+    {
+        lines = lines && reinterpret_cast<uintptr_t>(shards[i].StatList.data()) % 64 == 0;
+    }
+    ASSERT_TRUE(lines, "\tEvery shard's Stats entries should fill whole cache lines of their own");
+}
+
+/**
+ * @brief Tests that prepare copies the types and merge_Into adds and clears every shard.
+ */
+void test_MergeIntoAddsAndClears() {
+    Statistics total;
+    total.register_Type(0, "TypeA");
+    total.register_Type(1, "TypeB");
+
+    StatisticsShards shards;
+    shards.resize(3);
+    shards.prepare(total);
+    shards[0].log_Flight(0, 1.0, 100, 2);
+    shards[2].log_Flight(1, 2.0, 50, 1);
+    shards[2].log_Charge(1, 0.5);
+    shards.merge_Into(total);
+
+    ASSERT_TRUE(shards[1].type_Names.size() == 2 && shards[1].type_Names[1] == "TypeB", "\tShards should mirror the registered types");
+    ASSERT_TRUE(total.StatList[0].flight_count == 1 && total.StatList[1].flight_count == 1 && total.StatList[1].charge_count == 1,
+                "\tMerge should add every shard");
+    ASSERT_TRUE(shards[2].StatList[1].flight_count == 0 && shards[2].StatList[1].charge_Time.count() == 0, "\tMerge should clear the shards");
+}
+
+/**
+ * @brief Logs a fixed workload split over shards and returns the merged result.
+ * 
+ * @param threads Threads logging at the same time; each owns a contiguous range of shards.
+ * @return Stats Merged totals of the single type.
+ */
+Stats run_Sharded(size_t threads) {
+    Statistics total;
+    total.register_Type(0, "TypeA");
+
+    const size_t shard_Count = 16;
+    StatisticsShards shards;
+    shards.resize(shard_Count);
+    shards.prepare(total);
+
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&shards, t, threads] {
+            for (size_t s = shard_Count * t / threads; s < shard_Count * (t + 1) / threads; ++s)
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    shards[s].log_Flight(0, 0.1 * ((s * 1000 + i) % 37), 10.0, 2);
+                }
+            }
+        });
+    }
+    for (thread &w : workers)
+        w.join();
+
+    shards.merge_Into(total);
+    return total.StatList[0];
+}
+
+/**
+ * @brief Tests that the merged result does not depend on the number of threads writing the shards.
+ */
+void test_DeterministicAcrossThreads() {
+    Stats one = run_Sharded(1);
+    Stats four = run_Sharded(4);
+
+    ASSERT_TRUE(one.flight_count == 16000, "\tEvery logged flight should be merged");
+    ASSERT_TRUE(one.total_FlightTime == four.total_FlightTime && one.flight_Time.variance() == four.flight_Time.variance() &&
+                one.flight_Time.quantile(0.99) == four.flight_Time.quantile(0.99), "\tMerged result should be identical for any thread count");
+}
+
+/**
+ * @brief Main function to run all StatisticsShards related unit tests.
+ * 
+ * Executes all defined tests and prints their results to the console.
+ * 
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- StatisticsShards Unit Tests ---\n" << endl;
+    test_ShardsArePadded();
+    test_MergeIntoAddsAndClears();
+    test_DeterministicAcrossThreads();
+    cout << "\n--- All StatisticsShards Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
@@ -116,11 +116,12 @@ void test_AggregatedStats() {
  */
 void test_StatisticsAccessors() {
     Statistics stats;
+    stats.register_Type(0, "TestType");
 
-    stats.log_Charge("TestType", 1.0);
-    stats.log_Charge("TestType", 2.0);
-    stats.log_Faults("TestType");
-    stats.log_Flight("TestType", 3.0, 150.0, 2);  // 300 passenger miles
+    stats.log_Charge(0, 1.0);
+    stats.log_Charge(0, 2.0);
+    stats.log_Faults(0);
+    stats.log_Flight(0, 3.0, 150.0, 2);  // 300 passenger miles
 
     ASSERT_TRUE(stats.get_ChargerCount("TestType") == 2, "\tCharge count should be 2 for TestType");
 }
@@ -130,13 +131,28 @@ void test_StatisticsAccessors() {
  */
 void test_LogFaults_IncrementsProperly() {
     Statistics stats;
+    stats.register_Type(0, "Alpha");
+    stats.register_Type(1, "Delta");
 
-    stats.log_Faults("Delta");
-    stats.log_Faults("Delta");
+    stats.log_Faults(1);
+    stats.log_Faults(1);
 
     ASSERT_TRUE(stats.get_fault_Count("Delta") == 2, "\tFault count should be 2 for Delta");
 }
 
+/**
+ * @brief Verifies registered types are found by name and unknown names are reported as missing.
+ */
+void test_RegisteredTypeLookup() {
+    Statistics stats;
+    stats.register_Type(0, "Alpha");
+    stats.register_Type(1, "Bravo");
+
+    ASSERT_TRUE(stats.find_Type("Bravo") == 1, "\tRegistered type should map back to its id");
+    ASSERT_TRUE(stats.find_Type("Zulu") == -1, "\tUnknown type should not be found");
+    ASSERT_TRUE(stats.get_fault_Count("Zulu") == 0, "\tFault count of an unknown type should be 0");
+}
+
 /**
  * @brief Entry point to run all Statistics related unit tests.
  * 
@@ -152,6 +168,7 @@ int main() {
     test_AggregatedStats();
     test_StatisticsAccessors();
     test_LogFaults_IncrementsProperly();
+    test_RegisteredTypeLookup();
     cout << "--- All Statistics Tests Completed ---" << endl;
     return 0;
 }
@@ -0,0 +1,355 @@
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <cmath>
+
+#include "Vehicle.h"
+#include "VehicleFleet.h"
+#include "FleetKernels.h"
+#include "CertifiedTypes.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ * 
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message)\
+        if(!(condition)){\
+            cout << "FAIL" << message << endl; \
+        } \
+        else{ \
+            cout << "PASS" << message << endl; \
+        } \
+
+
+/**
+ * @brief Tests flying a vehicle with a full battery.
+ *
+ * Checks whether the battery depletes, distance increases, and passenger miles are logged
+ * correctly after one unit of flight.
+ */
+void test_FlyWithFullBattery() {
+    Vehicle v("TestFly", 100.0, 100.0, 1.0, 1.0, 4, 0.0);
+    VehicleFleet fleet;
+    int vi = fleet.add(0, v);
+    double time_increment = 0.5;
+
+    fleet.fly(vi, time_increment);
+    fleet.finalize_FlightSession(vi);
+    
+    ASSERT_TRUE(fleet.current_Battery[vi] < v.battery_Capacity, "\tBattery should decrease after flight");
+    ASSERT_TRUE(fleet.distanceFlown[vi] > 0, "\tDistance should increase after flight");
+    ASSERT_TRUE(fleet.passengerMiles[vi] > 0, "\tPassenger miles should increase after flight");
+}
+
+/**
+ * @brief Tests flying with a partially filled battery.
+ *
+ * Simulates a flight with insufficient battery for full duration, ensuring partial flight behavior
+ * is correctly handled and flight parameters are updated.
+ */
+void test_FlyWithPartialBattery() {
+    Vehicle v("PartialFly", 100.0, 10.0, 1.0, 2.0, 4, 0.0);
+    VehicleFleet fleet;
+    int vi = fleet.add(0, v);
+    double time_increment = 1.0;
+
+    fleet.current_Battery[vi] = 5.0;  // manually setting low battery
+    fleet.fly(vi, time_increment);
+    fleet.finalize_FlightSession(vi);
+
+    ASSERT_TRUE(fleet.current_Battery[vi] == 0.0, "\tBattery should be depleted after partial flight");  //fabs(fleet.current_Battery[vi]) < 1e-6
+    ASSERT_TRUE(fleet.distanceFlown[vi] > 0, "\tDistance should increase after partial flight");
+    ASSERT_TRUE(fleet.passengerMiles[vi] > 0, "\tPassenger miles should still be logged");
+}
+
+/**
+ * @brief Tests if charging from 0 battery level increases battery.
+ *
+ * Verifies charging logic starts properly when the battery is fully depleted.
+ */
+void test_ChargeFromZeroBattery() {
+    Vehicle v("ChargeTest", 100.0, 50.0, 1.0, 1.0, 4, 0.0);
+    VehicleFleet fleet;
+    int vi = fleet.add(0, v);
+    double time_increment = 0.5;
+
+    fleet.current_Battery[vi] = 0.0;
+    fleet.charge(vi, time_increment);
+
+    ASSERT_TRUE(fleet.current_Battery[vi] > 0.0, "\tBattery should increase after charging from 0");
+}
+
+/**
+ * @brief Test that battery does not exceed capacity after charging.
+ *
+ * Ensures the vehicle's battery is capped at its defined maximum capacity.
+ */
+void test_ChargeStopsAtCapacity() {
+    Vehicle v("ChargeLimit", 100.0, 50.0, 1.0, 1.0, 4, 0.0);
+    VehicleFleet fleet;
+    int vi = fleet.add(0, v);
+    double time_increment = 2.0;
+
+    fleet.current_Battery[vi] = 49.0;   
+    fleet.charge(vi, time_increment);
+
+    ASSERT_TRUE(fleet.current_Battery[vi] <= v.battery_Capacity, "\tBattery should not exceed capacity");    //v.battery_Capacity + 1e-6
+}
+
+/**
+ * @brief Test fault simulation with maximum probability.
+ *
+ * Simulates faults over multiple steps with 100% fault rate to confirm fault registration.
+ */
+void test_FaultSimulationHighProbability() {
+    Vehicle v("Faulty", 100.0, 100.0, 1.0, 1.0, 4, 1.0);  // 100% fault rate
+    VehicleFleet fleet;
+    int vi = fleet.add(0, v);
+    double time_increment = 1.0;
+    int initialFaults = fleet.fault_Count[vi];
+
+    for (int i = 0; i < 10; ++i) 
+    {
+        fleet.current_Battery[vi] = v.battery_Capacity;     // Keeps the vehicle airborne for the whole step
+        fleet.fly(vi, time_increment);
+        while (fleet.simulate_Fault(vi)) {}
+    }
+
+    ASSERT_TRUE(fleet.fault_Count[vi] > initialFaults, "\tFaults should occur when fault_Probability is 1.0");
+}
+
+/**
+ * @brief Tests that fault counts do not depend on the step size.
+ *
+ * Two fleets with the same seed fly the same hours in fine and coarse steps. Faults are
+ * placed on the flight-hour axis, so both must see the same faults.
+ */
+void test_FaultCountIndependentOfStep() {
+    Vehicle v("Steps", 1.0, 1e6, 1.0, 1.0, 1, 2.0);
+    VehicleFleet fine, coarse;
+    fine.set_Seed(11);
+    coarse.set_Seed(11);
+    int fi = fine.add(0, v);
+    int ci = coarse.add(0, v);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        fine.fly(fi, 0.01);
+        while (fine.simulate_Fault(fi)) {}
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        coarse.fly(ci, 5.0);
+        while (coarse.simulate_Fault(ci)) {}
+    }
+
+    ASSERT_TRUE(fine.fault_Count[fi] > 0, "\tFaults should occur over 20 flight hours at 2 faults per hour");
+    ASSERT_TRUE(fine.fault_Count[fi] == coarse.fault_Count[ci], "\tFault count should not depend on the step size");
+}
+
+/**
+ * @brief Tests that checking for faults draws no random numbers unless a fault fires.
+ *
+ * One draw places the first fault when the vehicle is added, then one more per fault.
+ */
+void test_FaultCheckDrawsOnlyOnFault() {
+    Vehicle v("Draws", 100.0, 1e6, 1.0, 1.0, 1, 0.3);
+    VehicleFleet fleet;
+    fleet.set_Seed(5);
+    int vi = fleet.add(0, v);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        fleet.fly(vi, 0.01);
+        while (fleet.simulate_Fault(vi)) {}
+    }
+
+    ASSERT_TRUE(fleet.rng_Counter[vi] == static_cast<uint32_t>(1 + fleet.fault_Count[vi]), "\tRandom draws should equal one plus the number of faults");
+}
+
+/**
+ * @brief Tests that flying a block of vehicles matches flying them one by one.
+ *
+ * Depleted vehicles inside the block must stay grounded.
+ */
+void test_FlyRangeMatchesSingle() {
+    Vehicle v("RangeFly", 100.0, 100.0, 1.0, 1.0, 4, 0.0);
+    VehicleFleet batch, single;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        batch.add(0, v);
+        single.add(0, v);
+    }
+    batch.current_Battery[2] = 0.0;
+    single.current_Battery[2] = 0.0;
+
+    batch.fly(0, batch.size(), 0.25);
+    for (int i = 0; i < 4; ++i)
+    {
+        single.fly(i, 0.25);
+    }
+
+    bool same = true;
+    for (int i = 0; i < 4; ++i)
+    {
+        same = same && batch.current_Battery[i] == single.current_Battery[i]
+                    && batch.session_Distance[i] == single.session_Distance[i];
+    }
+
+    ASSERT_TRUE(same, "\tBlock flight should match per-vehicle flight");
+    ASSERT_TRUE(batch.session_Distance[2] == 0.0, "\tDepleted vehicle should not fly");
+}
+
+/**
+ * @brief Tests the depletion flags written for a block of vehicles.
+ */
+void test_ChargeDepletedRange() {
+    Vehicle v("RangeDepleted", 100.0, 100.0, 1.0, 1.0, 4, 0.0);
+    VehicleFleet fleet;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        fleet.add(0, v);
+    }
+    fleet.current_Battery[1] = 0.0;
+
+    pmr::vector<char> depleted(fleet.size());
+    fleet.charge_depleted(0, fleet.size(), depleted);
+
+    ASSERT_TRUE(!depleted[0] && depleted[1] && !depleted[2], "\tOnly the empty vehicle should be flagged as depleted");
+}
+
+/**
+ * @brief Tests the batch kernels on a block spanning several SIMD widths.
+ *
+ * Mixes full flights, partial flights and grounded vehicles in the same block and compares
+ * against flying and charging each vehicle on its own.
+ */
+void test_BatchKernelsMatchSingle() {
+    Vehicle v("Batch", 100.0, 100.0, 0.5, 1.0, 3, 0.0);
+    VehicleFleet batch, single;
+    double start[] = {100.0, 30.0, 0.0, 55.0, 10.0, 0.0, 100.0, 49.9, 50.0, 1.0, 75.0};
+    int n = 11;
+
+    for (int i = 0; i < n; ++i)
+    {
+        batch.add(0, v);
+        single.add(0, v);
+        batch.current_Battery[i] = single.current_Battery[i] = start[i];
+        batch.actualCruiseSpeed[i] = single.actualCruiseSpeed[i] = 100.0 - i;
+    }
+
+    batch.fly(0, n, 0.5);
+    for (int i = 0; i < n; ++i)
+        single.fly(i, 0.5);
+
+    bool flySame = true;
+    for (int i = 0; i < n; ++i)
+    {
+        flySame = flySame && fabs(batch.current_Battery[i] - single.current_Battery[i]) < 1e-9
+                          && fabs(batch.session_FlightTime[i] - single.session_FlightTime[i]) < 1e-9
+                          && batch.session_PassengerMiles[i] == single.session_PassengerMiles[i];
+    }
+
+    batch.charge(0, n, 0.1);
+    for (int i = 0; i < n; ++i)
+        single.charge(i, 0.1);
+
+    bool chargeSame = true;
+    for (int i = 0; i < n; ++i)
+    {
+        chargeSame = chargeSame && fabs(batch.current_Battery[i] - single.current_Battery[i]) < 1e-9
+                                && fabs(batch.total_chargingTime[i] - single.total_chargingTime[i]) < 1e-9
+                                && batch.current_Battery[i] <= v.battery_Capacity;
+    }
+
+    ASSERT_TRUE(flySame, "\tBatch flight should match per-vehicle flight");
+    ASSERT_TRUE(batch.current_Battery[2] > 0.0 && batch.session_Distance[2] == 0.0, "\tGrounded vehicle should only charge");
+    ASSERT_TRUE(chargeSame, "\tBatch charging should match per-vehicle charging");
+}
+
+/**
+ * @brief Tests that every certified kernel gives bit-identical results to the generic one.
+ *
+ * Each type flies and charges a block of vehicles with full, partial and empty batteries
+ * and fault-degraded speeds through both kernels.
+ */
+void test_CertifiedKernelsMatchGeneric() {
+    const size_t n = 11;
+    bool flySame = true, chargeSame = true;
+
+    for (size_t t = 0; t < certified_TypeCount; ++t)
+    {
+        const TypeSpec &spec = certified_Types[t];
+        vector<double> battery(n), speed(n), energy(n, spec.energy_PerMile), rate(n, spec.charge_Rate()), capacity(n, spec.battery_Capacity);
+        vector<int> passengers(n, spec.passenger_Count);
+        for (size_t i = 0; i < n; ++i)
+        {
+            battery[i] = spec.battery_Capacity * (i % 4) / 3.0 * (i == 5 ? 0.01 : 1.0);
+            speed[i] = spec.cruiseSpeed * (1.0 - 0.02 * i);
+        }
+
+        vector<double> b1 = battery, b2 = battery, time1(n, 0.0), time2(n, 0.0), dist1(n, 0.0), dist2(n, 0.0);
+        vector<int> pm1(n, 0), pm2(n, 0);
+        FleetKernels::fly(b1.data(), speed.data(), energy.data(), passengers.data(), time1.data(), dist1.data(), pm1.data(), n, 0.5);
+        FleetKernels::fly_Certified(t, b2.data(), speed.data(), time2.data(), dist2.data(), pm2.data(), n, 0.5);
+        flySame = flySame && b1 == b2 && time1 == time2 && dist1 == dist2 && pm1 == pm2;
+
+        vector<double> charge1(n, 0.0), charge2(n, 0.0);
+        FleetKernels::charge(b1.data(), rate.data(), capacity.data(), charge1.data(), n, 0.1);
+        FleetKernels::charge_Certified(t, b2.data(), charge2.data(), n, 0.1);
+        chargeSame = chargeSame && b1 == b2 && charge1 == charge2;
+    }
+
+    ASSERT_TRUE(flySame, "\tCertified flight kernels should match the generic kernel exactly");
+    ASSERT_TRUE(chargeSame, "\tCertified charging kernels should match the generic kernel exactly");
+}
+
+/**
+ * @brief Tests that only types with exactly the certified parameters are routed to the certified kernels.
+ */
+void test_CertifiedTypesMatched() {
+    const TypeSpec &echo = certified_Types[4];
+    Vehicle certified(echo.name, echo.cruiseSpeed, echo.battery_Capacity, echo.timeTo_Charge,
+                      echo.energy_PerMile, echo.passenger_Count, echo.fault_Probability);
+    Vehicle modified(echo.name, echo.cruiseSpeed, echo.battery_Capacity, echo.timeTo_Charge,
+                     echo.energy_PerMile * 1.1, echo.passenger_Count, echo.fault_Probability);
+
+    VehicleFleet fleet;
+    fleet.add(0, certified, 3);
+    fleet.add(1, modified, 3);
+
+    ASSERT_TRUE(fleet.certified_Type.size() == 2 && fleet.certified_Type[0] == 4, "\tA certified type should map to its table entry");
+    ASSERT_TRUE(fleet.certified_Type[1] == -1, "\tA type with a changed parameter should use the generic kernels");
+}
+
+/**
+ * @brief Main function to run all related unit tests.
+ *
+ * Executes all defined test functions and prints pass/fail messages.
+ * 
+ * @return int Exit status of the test run.
+ */
+int main()
+{
+    cout << "--- Running Unit Tests ---\\n" << endl;
+    test_FlyWithFullBattery();
+    test_FlyWithPartialBattery();
+    test_ChargeFromZeroBattery();
+    test_ChargeStopsAtCapacity();
+    test_FaultSimulationHighProbability();
+    test_FaultCountIndependentOfStep();
+    test_FaultCheckDrawsOnlyOnFault();
+    test_FlyRangeMatchesSingle();
+    test_ChargeDepletedRange();
+    test_BatchKernelsMatchSingle();
+    test_CertifiedKernelsMatchGeneric();
+    test_CertifiedTypesMatched();
+    cout << "\\n--- All Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
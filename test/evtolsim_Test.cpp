@@ -0,0 +1,194 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdio>
+
+#include "evtolsim.h"
+#include "Simulation.h"
+
+using namespace std;
+
+/**
+ * @brief Asserts a condition and prints the result.
+ *
+ * @param condition Boolean expression to evaluate.
+ * @param message Message to display alongside pass/fail status.
+ */
+#define ASSERT_TRUE(condition, message) \
+    if (!(condition)) { \
+        cout << "FAIL " << message << endl; \
+    } else { \
+        cout << "PASS " << message << endl; \
+    } \
+
+/**
+ * @brief Creates a simulation of the built-in fleet with a fixed seed and two sites.
+ */
+evtol_sim* create_Seeded() {
+    evtol_config config;
+    evtol_config_init(&config);
+    config.seed = 42;
+    config.sites = 2;
+    config.chargers_per_site = 2;
+    return evtol_create(&config);
+}
+
+/**
+ * @brief Tests that stepping in pieces ends exactly like one run of the same length.
+ */
+void test_StepsMatchFullRun() {
+    evtol_sim *pieces = create_Seeded();
+    evtol_sim *whole = create_Seeded();
+
+    evtol_step(pieces, 1);
+    evtol_step(pieces, 4);
+    evtol_advance_to(pieces, 3.2);          // Ends on the tick boundary at 3.5
+    double end = evtol_step(pieces, 2);
+    evtol_step(whole, 9);
+
+    evtol_stats_view a, b;
+    evtol_stats(pieces, &a);
+    evtol_stats(whole, &b);
+
+    bool same = a.count == b.count && a.count == 5;
+    for (size_t i = 0; i < a.count; ++i)
+    {
+        same = same && evtol_stat_double(a.total_distance, a.stride, i) == evtol_stat_double(b.total_distance, b.stride, i) &&
+               evtol_stat_double(a.total_charging_time, a.stride, i) == evtol_stat_double(b.total_charging_time, b.stride, i) &&
+               evtol_stat_int(a.total_faults, a.stride, i) == evtol_stat_int(b.total_faults, b.stride, i) &&
+               evtol_stat_int(a.flight_count, a.stride, i) == evtol_stat_int(b.flight_count, b.stride, i);
+    }
+    ASSERT_TRUE(end == 4.5 && evtol_time(whole) == 4.5, "\tBoth simulations should end at 4.5 hours");
+    ASSERT_TRUE(same, "\tStepping in pieces should give the same statistics as one run");
+
+    evtol_config config;
+    evtol_config_init(&config);
+    config.seed = 42;
+    config.tick_threads = 4;                // Starts the tick threads inside the first step
+    evtol_sim *threaded = evtol_create(&config);
+    ASSERT_TRUE(threaded && evtol_step(threaded, 9) == 4.5 && *evtol_last_error() == '\0', "\tA threaded step should succeed with no error");
+
+    evtol_destroy(pieces);
+    evtol_destroy(whole);
+    evtol_destroy(threaded);
+}
+
+/**
+ * @brief Tests that the fleet view points into the simulation and stays valid across steps.
+ */
+void test_FleetViewIsLive() {
+    evtol_sim *sim = create_Seeded();
+    evtol_fleet_view before;
+    evtol_fleet(sim, &before);
+
+    bool full = before.count == 20;
+    for (size_t i = 0; i < before.count; ++i)
+    {
+        full = full && before.battery[i] == before.battery_capacity[i] && before.charge_state[i] == 0;
+    }
+    ASSERT_TRUE(full, "\tEvery vehicle should start idle with a full battery");
+
+    evtol_step(sim, 1);
+    double drained = before.battery[0];
+    evtol_fleet_view after;
+    ASSERT_TRUE(evtol_fleet(sim, &after) == 1 && *evtol_last_error() == '\0', "\tTaking the view should succeed with no error");
+
+    ASSERT_TRUE(after.battery == before.battery && after.type_id == before.type_id, "\tThe view should point at the same arrays after stepping");
+    ASSERT_TRUE(drained < after.battery_capacity[0] && before.total_flight_time[0] + before.session_flight_time[0] > 0,
+                "\tThe old view should already show the flight");
+
+    evtol_step(sim, 13);
+    evtol_fleet(sim, &after);
+    bool synced = true;
+    for (size_t i = 0; i < after.count; ++i)
+    {
+        synced = synced && after.battery[i] >= 0 && after.battery[i] <= after.battery_capacity[i] &&
+                 after.charge_state[i] <= 2 && evtol_type_name(sim, after.type_id[i]) != nullptr;
+    }
+    ASSERT_TRUE(synced, "\tBatteries, charger states and types should be in range after charging");
+
+    evtol_destroy(sim);
+}
+
+/**
+ * @brief Tests that the statistics view reads the same values as the simulation's own statistics.
+ */
+void test_StatsViewMatchesSimulation() {
+    evtol_config config;
+    evtol_config_init(&config);
+    config.seed = 7;
+    evtol_sim *sim = evtol_create(&config);
+    evtol_advance_to(sim, 3.0);
+
+    Simulation direct;
+    direct.set_PrintSummary(false);
+    direct.set_FaultLogPath("");
+    direct.set_Seed(7);
+    direct.vehicle_Init();
+    direct.advance_To(3.0);
+
+    evtol_stats_view view;
+    evtol_stats(sim, &view);
+    const Statistics &stats = direct.getStats();
+
+    bool same = view.count == stats.StatList.size();
+    for (size_t i = 0; same && i < view.count; ++i)
+    {
+        same = evtol_stat_double(view.total_flight_time, view.stride, i) == stats.StatList[i].total_FlightTime &&
+               evtol_stat_int(view.total_passenger_miles, view.stride, i) == stats.StatList[i].total_PassengerMiles &&
+               evtol_stat_int(view.charge_count, view.stride, i) == stats.StatList[i].charge_count &&
+               string(evtol_type_name(sim, static_cast<int>(i))) == stats.type_Names[i];
+    }
+    ASSERT_TRUE(same, "\tThe view should read the per-type statistics in place");
+    ASSERT_TRUE(evtol_type_name(sim, -1) == nullptr && evtol_type_name(sim, static_cast<int>(view.count)) == nullptr,
+                "\tUnknown types should have no name");
+
+    evtol_destroy(sim);
+}
+
+/**
+ * @brief Tests that a manifest is used when given and that bad input returns no simulation.
+ */
+void test_CreateFromManifest() {
+    const char *path = "evtolsim_test_manifest.csv";
+    {
+        ofstream out(path);
+        out << "type,Alpha,120,320,0.6,1.6,4,0.25\nfleet,Alpha,50\n";
+    }
+
+    evtol_config config;
+    evtol_config_init(&config);
+    config.manifest_path = path;
+    evtol_sim *sim = evtol_create(&config);
+    evtol_fleet_view fleet;
+    if (sim)
+        evtol_fleet(sim, &fleet);
+    ASSERT_TRUE(sim && fleet.count == 50 && *evtol_last_error() == '\0', "\tThe manifest's fleet should be built");
+    evtol_destroy(sim);
+
+    config.manifest_path = "no_such_manifest.csv";
+    ASSERT_TRUE(evtol_create(&config) == nullptr && *evtol_last_error() != '\0', "\tA missing manifest should fail with a reason");
+
+    config.manifest_path = nullptr;
+    config.time_increment = 0;
+    ASSERT_TRUE(evtol_create(&config) == nullptr && *evtol_last_error() != '\0', "\tA zero time increment should be rejected");
+
+    remove(path);
+}
+
+/**
+ * @brief Main function to run all C API related unit tests.
+ *
+ * Executes all defined tests and prints their results to the console.
+ *
+ * @return int Exit status.
+ */
+int main() {
+    cout << "--- evtolsim Unit Tests ---\n" << endl;
+    test_StepsMatchFullRun();
+    test_FleetViewIsLive();
+    test_StatsViewMatchesSimulation();
+    test_CreateFromManifest();
+    cout << "\n--- All evtolsim Tests Completed ---" << endl;
+    return 0;
+}
\ No newline at end of file
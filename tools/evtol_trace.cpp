@@ -0,0 +1,193 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+
+#include "TraceReader.h"
+
+using namespace std;
+
+namespace {
+    const char *kind_Names[] = {"FlightEnd", "Enqueue", "ChargeStart", "ChargeEnd", "Fault"};
+    const size_t kind_Count = sizeof(kind_Names) / sizeof(kind_Names[0]);
+    const size_t max_Bins = 10000;              // Histogram bins before the open-ended last one
+
+    /**
+     * @brief Prints how to call the tool.
+     */
+    void print_Usage()
+    {
+        cout << "Usage:\n"
+             << "  evtol-trace FILE summary             event counts per vehicle type and kind\n"
+             << "  evtol-trace FILE window T0 T1        every event with T0 <= time < T1\n"
+             << "  evtol-trace FILE waits [BIN_HOURS]   histogram of charger queue waits per vehicle type\n";
+    }
+
+    /**
+     * @brief Counts events per type and kind over the whole trace.
+     *
+     * Reads only the type and kind columns.
+     *
+     * @param trace Open trace.
+     */
+    void summary(const TraceReader &trace)
+    {
+        vector<vector<uint64_t>> counts(trace.type_Count() + 1, vector<uint64_t>(kind_Count, 0));
+
+        for (size_t b = 0; b < trace.block_Count(); ++b)
+        {
+            TraceBlock block = trace.block(b);
+            for (size_t i = 0; i < block.count; ++i)
+            {
+                size_t t = (block.type[i] >= 0 && static_cast<size_t>(block.type[i]) < trace.type_Count()) ? block.type[i] : trace.type_Count();
+                if (block.kind[i] < kind_Count)
+                    counts[t][block.kind[i]]++;
+            }
+        }
+
+        cout << "Events: " << trace.event_Count() << " in " << trace.block_Count() << " blocks\n";
+        cout << left << setw(20) << "Type";
+        for (const char *k : kind_Names)
+            cout << right << setw(13) << k;
+        cout << "\n";
+
+        for (size_t t = 0; t < counts.size(); ++t)
+        {
+            if (t == trace.type_Count() && counts[t] == vector<uint64_t>(kind_Count, 0))
+                continue;
+            cout << left << setw(20) << trace.type_Name(static_cast<TypeId>(t));
+            for (uint64_t c : counts[t])
+                cout << right << setw(13) << c;
+            cout << "\n";
+        }
+    }
+
+    /**
+     * @brief Prints every event inside a time window.
+     *
+     * Jumps to the first block of the window by binary search and stops at the first later event.
+     *
+     * @param trace Open trace.
+     * @param t0 Start of the window, inclusive.
+     * @param t1 End of the window, exclusive.
+     */
+    void window(const TraceReader &trace, double t0, double t1)
+    {
+        cout << "Time\tKind\tVehicle\tType\tValue\n";
+        for (size_t b = trace.find_Block(t0); b < trace.block_Count(); ++b)
+        {
+            TraceBlock block = trace.block(b);
+            for (size_t i = 0; i < block.count; ++i)
+            {
+                if (block.time[i] >= t1)
+                    return;
+                if (block.time[i] < t0)
+                    continue;
+                cout << block.time[i] << "\t" << (block.kind[i] < kind_Count ? kind_Names[block.kind[i]] : "?")
+                     << "\t" << block.vehicle[i] << "\t" << trace.type_Name(block.type[i]) << "\t" << block.value[i] << "\n";
+            }
+        }
+    }
+
+    /**
+     * @brief Prints a histogram of charger queue waits for each vehicle type.
+     *
+     * Uses the value column of ChargeStart events. Waits beyond max_Bins bins share one
+     * open-ended bin, and values a damaged trace may hold (negative, infinite, NaN) are
+     * counted as skipped rather than binned.
+     *
+     * @param trace Open trace.
+     * @param bin Width of each histogram bin in hours, positive and finite.
+     */
+    void waits(const TraceReader &trace, double bin)
+    {
+        vector<vector<uint64_t>> histogram(trace.type_Count());
+        uint64_t skipped = 0;
+
+        for (size_t b = 0; b < trace.block_Count(); ++b)
+        {
+            TraceBlock block = trace.block(b);
+            for (size_t i = 0; i < block.count; ++i)
+            {
+                if (block.kind[i] != static_cast<uint8_t>(TraceKind::ChargeStart))
+                    continue;
+                if (block.type[i] < 0 || static_cast<size_t>(block.type[i]) >= histogram.size())
+                    continue;
+
+                double position = block.value[i] / bin;
+                if (!(position >= 0.0) || !isfinite(position))
+                {
+                    skipped++;
+                    continue;
+                }
+                size_t slot = position < max_Bins ? static_cast<size_t>(position) : max_Bins;
+                vector<uint64_t> &h = histogram[block.type[i]];
+                if (h.size() <= slot)
+                    h.resize(slot + 1, 0);
+                h[slot]++;
+            }
+        }
+
+        for (size_t t = 0; t < histogram.size(); ++t)
+        {
+            cout << trace.type_Name(static_cast<TypeId>(t)) << "\n";
+            for (size_t s = 0; s < histogram[t].size(); ++s)
+            {
+                if (histogram[t][s] == 0)
+                    continue;
+                if (s == max_Bins)
+                    cout << "  [" << s * bin << ", inf) hrs: " << histogram[t][s] << "\n";
+                else
+                    cout << "  [" << s * bin << ", " << (s + 1) * bin << ") hrs: " << histogram[t][s] << "\n";
+            }
+        }
+        if (skipped > 0)
+            cout << "Skipped " << skipped << " waits that are negative or not finite\n";
+    }
+}
+
+/**
+ * @brief Answers queries about a binary event trace without re-running the simulation.
+ *
+ * The trace is memory-mapped, so only the columns a query reads are paged in.
+ *
+ * @return int 0 on success, 1 on bad arguments or an unreadable trace.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        print_Usage();
+        return 1;
+    }
+
+    TraceReader trace;
+    if (!trace.open(argv[1]))
+    {
+        cerr << "Cannot read trace " << argv[1] << endl;
+        return 1;
+    }
+
+    if (strcmp(argv[2], "summary") == 0)
+        summary(trace);
+    else if (strcmp(argv[2], "window") == 0 && argc >= 5)
+        window(trace, atof(argv[3]), atof(argv[4]));
+    else if (strcmp(argv[2], "waits") == 0)
+    {
+        double bin = argc >= 4 ? atof(argv[3]) : 0.1;
+        if (!(bin > 0.0) || !isfinite(bin))
+        {
+            cerr << "BIN_HOURS must be a positive number" << endl;
+            return 1;
+        }
+        waits(trace, bin);
+    }
+    else
+    {
+        print_Usage();
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file